@@ -0,0 +1,325 @@
+/*
+ * neom8x_bench.c
+ *
+ *  Created on: 16 oct. 2026
+ *      Author: Ludo
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "neom8x.h"
+#include "neom8x_hw.h"
+#include "types.h"
+
+/*** NEOM8X BENCH local macros ***/
+
+#define NEOM8X_BENCH_ITERATIONS_DEFAULT     2000
+#define NEOM8X_BENCH_LINE_SIZE_BYTES        256
+#define NEOM8X_BENCH_CORPUS_SIZE_MAX        256
+#define NEOM8X_BENCH_NAME_OFFSET            3
+#define NEOM8X_BENCH_NAME_SIZE_BYTES        3
+
+/*** NEOM8X BENCH local structures ***/
+
+/*******************************************************************/
+typedef enum {
+    NEOM8X_BENCH_PARSER_ZDA = 0,
+    NEOM8X_BENCH_PARSER_GGA,
+    NEOM8X_BENCH_PARSER_LAST
+} NEOM8X_BENCH_parser_t;
+
+/*******************************************************************/
+typedef struct {
+    char_t* sentence;
+    uint32_t size_bytes;
+    NEOM8X_BENCH_parser_t parser;
+} NEOM8X_BENCH_sentence_t;
+
+/*******************************************************************/
+typedef struct {
+    uint64_t duration_ns;
+    uint32_t sentence_count;
+    uint32_t found_count;
+} NEOM8X_BENCH_counter_t;
+
+/*******************************************************************/
+typedef struct {
+    NEOM8X_BENCH_counter_t isr;
+    NEOM8X_BENCH_counter_t parser[NEOM8X_BENCH_PARSER_LAST];
+    NEOM8X_statistics_t statistics;
+} NEOM8X_BENCH_results_t;
+
+/*******************************************************************/
+typedef struct {
+    NEOM8X_HW_rx_irq_cb_t rx_irq_callback;
+#ifdef NEOM8X_DRIVER_RX_BLOCK
+    NEOM8X_HW_rx_block_cb_t rx_block_callback;
+#endif
+    volatile uint8_t frame_published_flag;
+    NEOM8X_BENCH_sentence_t corpus[NEOM8X_BENCH_CORPUS_SIZE_MAX];
+    uint32_t corpus_size;
+    NEOM8X_BENCH_results_t* results;
+} NEOM8X_BENCH_context_t;
+
+/*** NEOM8X BENCH local global variables ***/
+
+static const char_t* const NEOM8X_BENCH_PARSER_NAME[NEOM8X_BENCH_PARSER_LAST] = { "ZDA", "GGA" };
+
+static NEOM8X_BENCH_context_t neom8x_bench_ctx;
+
+/*** NEOM8X HW functions (host stubs) ***/
+
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_HW_init(NEOM8X_HW_configuration_t* configuration) {
+    neom8x_bench_ctx.rx_irq_callback = (configuration->rx_irq_callback);
+#ifdef NEOM8X_DRIVER_RX_BLOCK
+    neom8x_bench_ctx.rx_block_callback = (configuration->rx_block_callback);
+#endif
+    return NEOM8X_SUCCESS;
+}
+
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_HW_de_init(void) {
+    return NEOM8X_SUCCESS;
+}
+
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_HW_send_message(uint8_t* message, uint32_t message_size_bytes) {
+    // Commands are not acknowledged: the configuration pipeline stays pending, which does not affect reception.
+    UNUSED(message);
+    UNUSED(message_size_bytes);
+    return NEOM8X_SUCCESS;
+}
+
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_HW_start_rx(void) {
+    return NEOM8X_SUCCESS;
+}
+
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_HW_stop_rx(void) {
+    return NEOM8X_SUCCESS;
+}
+
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_HW_delay_milliseconds(uint32_t delay_ms) {
+    UNUSED(delay_ms);
+    return NEOM8X_SUCCESS;
+}
+
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_HW_start_timer(uint32_t duration_ms) {
+    UNUSED(duration_ms);
+    return NEOM8X_SUCCESS;
+}
+
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_HW_stop_timer(void) {
+    return NEOM8X_SUCCESS;
+}
+
+/*** NEOM8X BENCH local functions ***/
+
+/*******************************************************************/
+static uint64_t _NEOM8X_BENCH_get_time_ns(void) {
+    // Local variables.
+    struct timespec now;
+    // Read monotonic clock.
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (((uint64_t) now.tv_sec) * 1000000000ULL) + ((uint64_t) now.tv_nsec);
+}
+
+/*******************************************************************/
+static void _NEOM8X_BENCH_process_callback(void) {
+    // Called by the driver when a frame has been published in the ring buffer.
+    neom8x_bench_ctx.frame_published_flag = 1;
+}
+
+/*******************************************************************/
+static void _NEOM8X_BENCH_completion_callback(NEOM8X_gps_data_t gps_data, NEOM8X_acquisition_status_t acquisition_status) {
+    // Count decoded data in the results of the current run.
+    UNUSED(acquisition_status);
+    if (neom8x_bench_ctx.results == NULL) return;
+    switch (gps_data) {
+    case NEOM8X_GPS_DATA_TIME:
+        neom8x_bench_ctx.results->parser[NEOM8X_BENCH_PARSER_ZDA].found_count++;
+        break;
+    case NEOM8X_GPS_DATA_POSITION:
+        neom8x_bench_ctx.results->parser[NEOM8X_BENCH_PARSER_GGA].found_count++;
+        break;
+    default:
+        break;
+    }
+}
+
+/*******************************************************************/
+static int _NEOM8X_BENCH_load_corpus(const char_t* corpus_path) {
+    // Local variables.
+    FILE* corpus_file = NULL;
+    char_t line[NEOM8X_BENCH_LINE_SIZE_BYTES];
+    NEOM8X_BENCH_sentence_t* sentence = NULL;
+    size_t line_size = 0;
+    int status = -1;
+    // Open file.
+    corpus_file = fopen(corpus_path, "r");
+    if (corpus_file == NULL) {
+        fprintf(stderr, "Unable to open corpus %s\r\n", corpus_path);
+        goto errors;
+    }
+    // Read sentences.
+    while (fgets(line, sizeof(line), corpus_file) != NULL) {
+        // Remove line ending.
+        line_size = strcspn(line, "\r\n");
+        line[line_size] = '\0';
+        // Skip comments and empty lines.
+        if ((line_size == 0) || (line[0] == '#')) continue;
+        if (neom8x_bench_ctx.corpus_size >= NEOM8X_BENCH_CORPUS_SIZE_MAX) break;
+        // Store sentence with NMEA line ending.
+        sentence = &(neom8x_bench_ctx.corpus[neom8x_bench_ctx.corpus_size]);
+        sentence->sentence = malloc(line_size + 3);
+        if ((sentence->sentence) == NULL) goto errors;
+        memcpy(sentence->sentence, line, line_size);
+        memcpy(&((sentence->sentence)[line_size]), "\r\n", 3);
+        sentence->size_bytes = (uint32_t) (line_size + 2);
+        // Identify parser.
+        sentence->parser = NEOM8X_BENCH_PARSER_LAST;
+        if (line_size >= (NEOM8X_BENCH_NAME_OFFSET + NEOM8X_BENCH_NAME_SIZE_BYTES)) {
+            if (memcmp(&(line[NEOM8X_BENCH_NAME_OFFSET]), "ZDA", NEOM8X_BENCH_NAME_SIZE_BYTES) == 0) {
+                sentence->parser = NEOM8X_BENCH_PARSER_ZDA;
+            }
+            if (memcmp(&(line[NEOM8X_BENCH_NAME_OFFSET]), "GGA", NEOM8X_BENCH_NAME_SIZE_BYTES) == 0) {
+                sentence->parser = NEOM8X_BENCH_PARSER_GGA;
+            }
+        }
+        neom8x_bench_ctx.corpus_size++;
+    }
+    status = 0;
+errors:
+    if (corpus_file != NULL) {
+        fclose(corpus_file);
+    }
+    return status;
+}
+
+/*******************************************************************/
+static void _NEOM8X_BENCH_run(uint32_t iterations, uint8_t block_flag, NEOM8X_BENCH_results_t* results) {
+    // Local variables.
+    NEOM8X_BENCH_sentence_t* sentence = NULL;
+    NEOM8X_BENCH_counter_t* counter = NULL;
+    uint64_t start_ns = 0;
+    uint32_t iteration = 0;
+    uint32_t sentence_idx = 0;
+    uint32_t idx = 0;
+#ifndef NEOM8X_DRIVER_RX_BLOCK
+    UNUSED(block_flag);
+#endif
+    // Start from zero for this run.
+    memset(results, 0, sizeof(NEOM8X_BENCH_results_t));
+    NEOM8X_reset_statistics();
+    neom8x_bench_ctx.results = results;
+    // Feed the corpus sentence by sentence, so that the ring buffer never overflows.
+    for (iteration = 0; iteration < iterations; iteration++) {
+        for (sentence_idx = 0; sentence_idx < neom8x_bench_ctx.corpus_size; sentence_idx++) {
+            sentence = &(neom8x_bench_ctx.corpus[sentence_idx]);
+            neom8x_bench_ctx.frame_published_flag = 0;
+            // Reception interrupt path.
+            start_ns = _NEOM8X_BENCH_get_time_ns();
+#ifdef NEOM8X_DRIVER_RX_BLOCK
+            if (block_flag != 0) {
+                // One sentence per block, as with an idle line interrupt.
+                neom8x_bench_ctx.rx_block_callback((uint8_t*) (sentence->sentence), (sentence->size_bytes));
+            }
+            else
+#endif
+            {
+                for (idx = 0; idx < (sentence->size_bytes); idx++) {
+                    neom8x_bench_ctx.rx_irq_callback((uint8_t) (sentence->sentence)[idx]);
+                }
+            }
+            results->isr.duration_ns += (_NEOM8X_BENCH_get_time_ns() - start_ns);
+            results->isr.sentence_count++;
+            results->isr.found_count += (sentence->size_bytes);
+            // Parser path (only for frames accepted by the reception state machine).
+            if (neom8x_bench_ctx.frame_published_flag == 0) continue;
+            start_ns = _NEOM8X_BENCH_get_time_ns();
+            NEOM8X_process();
+            if ((sentence->parser) >= NEOM8X_BENCH_PARSER_LAST) continue;
+            counter = &(results->parser[sentence->parser]);
+            counter->duration_ns += (_NEOM8X_BENCH_get_time_ns() - start_ns);
+            counter->sentence_count++;
+        }
+    }
+    neom8x_bench_ctx.results = NULL;
+    NEOM8X_get_statistics(&(results->statistics));
+}
+
+/*******************************************************************/
+static void _NEOM8X_BENCH_print_results(const char_t* run_name, NEOM8X_BENCH_results_t* results) {
+    // Local variables.
+    NEOM8X_BENCH_counter_t* counter = NULL;
+    NEOM8X_statistics_t* statistics = &(results->statistics);
+    uint8_t idx = 0;
+    // ISR path (found count is used as byte count).
+    printf("Run     : %s\r\n", run_name);
+    printf("ISR     : %10u bytes %8.2f ns/byte\r\n", results->isr.found_count, (double) results->isr.duration_ns / (double) results->isr.found_count);
+    // Parsers.
+    for (idx = 0; idx < NEOM8X_BENCH_PARSER_LAST; idx++) {
+        counter = &(results->parser[idx]);
+        printf("%s     : %10u frames %8.2f ns/sentence (%u decoded)\r\n", NEOM8X_BENCH_PARSER_NAME[idx], counter->sentence_count, (counter->sentence_count == 0) ? 0.0 : ((double) counter->duration_ns / (double) counter->sentence_count), counter->found_count);
+    }
+    // Driver counters.
+    printf("Driver  : %u frames, %u checksum errors, %u field size errors, %u invalid data, %u frames dropped, %u buffer overflows\r\n",
+        statistics->frame_count, statistics->checksum_error_count, statistics->field_size_error_count, statistics->data_validity_error_count, statistics->frame_dropped_count, statistics->buffer_overflow_count);
+}
+
+/*** NEOM8X BENCH main function ***/
+
+/*******************************************************************/
+int main(int argc, char* argv[]) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    NEOM8X_acquisition_t acquisition;
+    NEOM8X_BENCH_results_t results;
+    const char_t* corpus_path = NEOM8X_BENCH_CORPUS_PATH;
+    uint32_t iterations = NEOM8X_BENCH_ITERATIONS_DEFAULT;
+    // Parse arguments.
+    if (argc > 1) {
+        corpus_path = argv[1];
+    }
+    if (argc > 2) {
+        iterations = (uint32_t) strtoul(argv[2], NULL, 10);
+    }
+    // Load corpus.
+    memset(&neom8x_bench_ctx, 0, sizeof(neom8x_bench_ctx));
+    if (_NEOM8X_BENCH_load_corpus(corpus_path) != 0) goto errors;
+    // Start driver.
+    status = NEOM8X_init();
+    if (status != NEOM8X_SUCCESS) goto errors;
+    memset(&acquisition, 0, sizeof(acquisition));
+    acquisition.gps_data = (NEOM8X_GPS_DATA_TIME | NEOM8X_GPS_DATA_POSITION);
+    acquisition.mode = NEOM8X_ACQUISITION_MODE_NMEA;
+    acquisition.process_callback = &_NEOM8X_BENCH_process_callback;
+    acquisition.completion_callback = &_NEOM8X_BENCH_completion_callback;
+    acquisition.altitude_stability_threshold = NEOM8X_DRIVER_ALTITUDE_STABILITY_THRESHOLD;
+    acquisition.horizontal_stability_threshold_m = NEOM8X_DRIVER_POSITION_STABILITY_HORIZONTAL_M;
+    acquisition.vertical_stability_threshold_m = NEOM8X_DRIVER_POSITION_STABILITY_VERTICAL_M;
+    status = NEOM8X_start_acquisition(&acquisition);
+    if (status != NEOM8X_SUCCESS) goto errors;
+    // Run benchmark.
+    printf("Corpus  : %s (%u sentences x %u iterations)\r\n", corpus_path, neom8x_bench_ctx.corpus_size, iterations);
+    _NEOM8X_BENCH_run(iterations, 0, &results);
+    _NEOM8X_BENCH_print_results("byte reception", &results);
+#ifdef NEOM8X_DRIVER_RX_BLOCK
+    _NEOM8X_BENCH_run(iterations, 1, &results);
+    _NEOM8X_BENCH_print_results("block reception", &results);
+#endif
+    return 0;
+errors:
+    fprintf(stderr, "Benchmark error (driver status %d)\r\n", (int) status);
+    return 1;
+}
@@ -0,0 +1,161 @@
+/*
+ * neom8x_decoder_check.c
+ *
+ *  Created on: 16 oct. 2026
+ *      Author: Ludo
+ */
+
+#include <stdio.h>
+
+// Driver source is included to reach the static decimal decoder.
+#include "neom8x.c"
+
+/*** NEOM8X DECODER CHECK local macros ***/
+
+#define NEOM8X_DECODER_CHECK_FIELD_SIZE_BYTES       16
+#define NEOM8X_DECODER_CHECK_EXHAUSTIVE_DIGITS_MAX  4
+#define NEOM8X_DECODER_CHECK_RANDOM_COUNT           1000000
+#define NEOM8X_DECODER_CHECK_VALUE_UNSET            0xA5A5A5A5
+#define NEOM8X_DECODER_CHECK_ERROR_PRINT_MAX        10
+#define NEOM8X_DECODER_CHECK_SEED                   0x12345678
+
+/*** NEOM8X DECODER CHECK local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    uint32_t random_state;
+    uint32_t case_count;
+    uint32_t error_count;
+} NEOM8X_DECODER_CHECK_context_t;
+
+/*** NEOM8X DECODER CHECK local global variables ***/
+
+static NEOM8X_DECODER_CHECK_context_t neom8x_decoder_check_ctx;
+
+/*** NEOM8X DECODER CHECK local functions ***/
+
+/*******************************************************************/
+static uint32_t _NEOM8X_DECODER_CHECK_random(void) {
+    // Xorshift generator (reproducible sequence).
+    neom8x_decoder_check_ctx.random_state ^= (neom8x_decoder_check_ctx.random_state << 13);
+    neom8x_decoder_check_ctx.random_state ^= (neom8x_decoder_check_ctx.random_state >> 17);
+    neom8x_decoder_check_ctx.random_state ^= (neom8x_decoder_check_ctx.random_state << 5);
+    return neom8x_decoder_check_ctx.random_state;
+}
+
+/*******************************************************************/
+static uint8_t _NEOM8X_DECODER_CHECK_decode_reference(char_t* str, uint8_t number_of_digits, uint32_t* value) {
+    // Local variables.
+    uint32_t result = 0;
+    uint8_t idx = 0;
+    // Scalar reference: one digit at a time, any non-digit character or empty field is rejected.
+    if ((number_of_digits == 0) || (number_of_digits > NEOM8X_DECIMAL_DIGITS_MAX)) return 0;
+    for (idx = 0; idx < number_of_digits; idx++) {
+        if ((str[idx] < '0') || (str[idx] > '9')) return 0;
+        result = (result * 10) + (uint32_t) (str[idx] - '0');
+    }
+    (*value) = result;
+    return 1;
+}
+
+/*******************************************************************/
+static void _NEOM8X_DECODER_CHECK_fill(char_t* field, uint8_t number_of_digits) {
+    // Local variables.
+    uint8_t idx = 0;
+    // Random digits followed by random bytes, which must not be read by the decoders.
+    for (idx = 0; idx < NEOM8X_DECODER_CHECK_FIELD_SIZE_BYTES; idx++) {
+        field[idx] = (idx < number_of_digits) ? (char_t) ('0' + (_NEOM8X_DECODER_CHECK_random() % 10)) : (char_t) (_NEOM8X_DECODER_CHECK_random() & 0xFF);
+    }
+}
+
+/*******************************************************************/
+static void _NEOM8X_DECODER_CHECK_compare(char_t* field, uint8_t number_of_digits) {
+    // Local variables.
+    uint32_t reference_value = NEOM8X_DECODER_CHECK_VALUE_UNSET;
+    uint32_t value = NEOM8X_DECODER_CHECK_VALUE_UNSET;
+    uint8_t reference_flag = 0;
+    uint8_t flag = 0;
+    uint8_t idx = 0;
+    // Decode field with both decoders.
+    reference_flag = _NEOM8X_DECODER_CHECK_decode_reference(field, number_of_digits, &reference_value);
+    flag = _NEOM8X_decode_decimal(field, number_of_digits, &value);
+    neom8x_decoder_check_ctx.case_count++;
+    // Results must match (value is only compared on success).
+    if ((flag == reference_flag) && ((flag == 0) || (value == reference_value))) return;
+    neom8x_decoder_check_ctx.error_count++;
+    if (neom8x_decoder_check_ctx.error_count > NEOM8X_DECODER_CHECK_ERROR_PRINT_MAX) return;
+    printf("mismatch on %u digits [", number_of_digits);
+    for (idx = 0; idx < number_of_digits; idx++) {
+        printf(" %02X", (unsigned int) ((uint8_t) field[idx]));
+    }
+    printf(" ]: reference=%u (%u) decoder=%u (%u)\r\n", reference_flag, reference_value, flag, value);
+}
+
+/*******************************************************************/
+static void _NEOM8X_DECODER_CHECK_run(void) {
+    // Local variables.
+    char_t field[NEOM8X_DECODER_CHECK_FIELD_SIZE_BYTES];
+    uint32_t value_max = 1;
+    uint32_t value = 0;
+    uint32_t count = 0;
+    uint16_t byte = 0;
+    uint8_t number_of_digits = 0;
+    uint8_t idx = 0;
+    // Empty fields and fields longer than the decoder capacity.
+    for (number_of_digits = 0; number_of_digits < NEOM8X_DECODER_CHECK_FIELD_SIZE_BYTES; number_of_digits++) {
+        if ((number_of_digits > 0) && (number_of_digits <= NEOM8X_DECIMAL_DIGITS_MAX)) continue;
+        _NEOM8X_DECODER_CHECK_fill(field, number_of_digits);
+        _NEOM8X_DECODER_CHECK_compare(field, number_of_digits);
+    }
+    // All values with leading zeros for short fields.
+    for (number_of_digits = 1; number_of_digits <= NEOM8X_DECODER_CHECK_EXHAUSTIVE_DIGITS_MAX; number_of_digits++) {
+        value_max *= 10;
+        for (value = 0; value < value_max; value++) {
+            _NEOM8X_DECODER_CHECK_fill(field, number_of_digits);
+            count = value;
+            for (idx = number_of_digits; idx > 0; idx--) {
+                field[idx - 1] = (char_t) ('0' + (count % 10));
+                count /= 10;
+            }
+            _NEOM8X_DECODER_CHECK_compare(field, number_of_digits);
+        }
+    }
+    // Random digits for longer fields, including all zeros and all nines.
+    for (number_of_digits = (NEOM8X_DECODER_CHECK_EXHAUSTIVE_DIGITS_MAX + 1); number_of_digits <= NEOM8X_DECIMAL_DIGITS_MAX; number_of_digits++) {
+        for (count = 0; count < NEOM8X_DECODER_CHECK_RANDOM_COUNT; count++) {
+            _NEOM8X_DECODER_CHECK_fill(field, number_of_digits);
+            _NEOM8X_DECODER_CHECK_compare(field, number_of_digits);
+        }
+        for (byte = '0'; byte <= '9'; byte = (uint16_t) (byte + 9)) {
+            _NEOM8X_DECODER_CHECK_fill(field, number_of_digits);
+            for (idx = 0; idx < number_of_digits; idx++) {
+                field[idx] = (char_t) byte;
+            }
+            _NEOM8X_DECODER_CHECK_compare(field, number_of_digits);
+        }
+    }
+    // Every byte value at every position of every field size.
+    for (number_of_digits = 1; number_of_digits <= NEOM8X_DECIMAL_DIGITS_MAX; number_of_digits++) {
+        for (idx = 0; idx < number_of_digits; idx++) {
+            for (byte = 0; byte <= 0xFF; byte++) {
+                _NEOM8X_DECODER_CHECK_fill(field, number_of_digits);
+                field[idx] = (char_t) byte;
+                _NEOM8X_DECODER_CHECK_compare(field, number_of_digits);
+            }
+        }
+    }
+}
+
+/*** NEOM8X DECODER CHECK main function ***/
+
+/*******************************************************************/
+int main(void) {
+    // Init context.
+    neom8x_decoder_check_ctx.random_state = NEOM8X_DECODER_CHECK_SEED;
+    neom8x_decoder_check_ctx.case_count = 0;
+    neom8x_decoder_check_ctx.error_count = 0;
+    // Compare the driver decoder with the scalar reference.
+    _NEOM8X_DECODER_CHECK_run();
+    printf("%s decimal decoder: %u cases, %u mismatches\r\n", (NEOM8X_DECIMAL_DECODER_SWAR != 0) ? "SWAR" : "Loop", neom8x_decoder_check_ctx.case_count, neom8x_decoder_check_ctx.error_count);
+    return ((neom8x_decoder_check_ctx.error_count == 0) ? 0 : 1);
+}
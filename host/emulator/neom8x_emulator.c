@@ -0,0 +1,1235 @@
+/*
+ * neom8x_emulator.c
+ *
+ *  Created on: 16 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "neom8x_emulator.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "neom8x.h"
+#include "neom8x_hw.h"
+#include "types.h"
+
+/*** NEOM8X EMULATOR local macros ***/
+
+#define NEOM8X_EMULATOR_UART_FRAME_SIZE_BITS        10
+#define NEOM8X_EMULATOR_TX_BUFFER_SIZE_BYTES        4096
+#define NEOM8X_EMULATOR_SENTENCE_SIZE_BYTES         128
+#define NEOM8X_EMULATOR_RX_BLOCK_SIZE_MAX_BYTES     1024
+
+#define NEOM8X_EMULATOR_NS_PER_MS                   1000000ULL
+#define NEOM8X_EMULATOR_NS_PER_CS                   10000000ULL
+#define NEOM8X_EMULATOR_CS_PER_DAY                  8640000ULL
+
+#define NEOM8X_EMULATOR_UBX_SYNC_CHAR_1             0xB5
+#define NEOM8X_EMULATOR_UBX_SYNC_CHAR_2             0x62
+#define NEOM8X_EMULATOR_UBX_OVERHEAD_SIZE_BYTES     8
+#define NEOM8X_EMULATOR_UBX_PAYLOAD_OFFSET          6
+
+#define NEOM8X_EMULATOR_UBX_CLASS_NAV               0x01
+#define NEOM8X_EMULATOR_UBX_ID_NAV_PVT              0x07
+#define NEOM8X_EMULATOR_UBX_CLASS_ACK               0x05
+#define NEOM8X_EMULATOR_UBX_ID_ACK_NAK              0x00
+#define NEOM8X_EMULATOR_UBX_ID_ACK_ACK              0x01
+#define NEOM8X_EMULATOR_UBX_CLASS_CFG               0x06
+#define NEOM8X_EMULATOR_UBX_ID_CFG_PRT              0x00
+#define NEOM8X_EMULATOR_UBX_ID_CFG_MSG              0x01
+#define NEOM8X_EMULATOR_UBX_ID_CFG_RST              0x04
+#define NEOM8X_EMULATOR_UBX_ID_CFG_RATE             0x08
+#define NEOM8X_EMULATOR_UBX_ID_CFG_RXM              0x11
+#define NEOM8X_EMULATOR_UBX_ID_CFG_PM2              0x3B
+#define NEOM8X_EMULATOR_UBX_CLASS_RXM               0x02
+#define NEOM8X_EMULATOR_UBX_ID_RXM_PMREQ            0x41
+#define NEOM8X_EMULATOR_UBX_ID_CFG_NAVX5            0x23
+#define NEOM8X_EMULATOR_UBX_CLASS_NMEA              0xF0
+#define NEOM8X_EMULATOR_UBX_CLASS_MGA               0x13
+#define NEOM8X_EMULATOR_UBX_ID_MGA_GPS              0x00
+#define NEOM8X_EMULATOR_UBX_ID_MGA_GAL              0x02
+#define NEOM8X_EMULATOR_UBX_ID_MGA_BDS              0x03
+#define NEOM8X_EMULATOR_UBX_ID_MGA_QZSS             0x05
+#define NEOM8X_EMULATOR_UBX_ID_MGA_GLO              0x06
+#define NEOM8X_EMULATOR_UBX_ID_MGA_ANO              0x20
+#define NEOM8X_EMULATOR_UBX_ID_MGA_INI              0x40
+#define NEOM8X_EMULATOR_UBX_ID_MGA_ACK              0x60
+#define NEOM8X_EMULATOR_UBX_CLASS_UPD               0x09
+#define NEOM8X_EMULATOR_UBX_ID_UPD_SOS              0x14
+
+#define NEOM8X_EMULATOR_CFG_PRT_PAYLOAD_SIZE_BYTES  20
+#define NEOM8X_EMULATOR_CFG_PRT_PORT_ID_UART1       1
+#define NEOM8X_EMULATOR_CFG_PRT_MODE_8N1            0x000008C0
+#define NEOM8X_EMULATOR_CFG_MSG_PAYLOAD_SIZE_BYTES  8
+#define NEOM8X_EMULATOR_CFG_MSG_SHORT_SIZE_BYTES    3
+#define NEOM8X_EMULATOR_CFG_RATE_PAYLOAD_SIZE_BYTES 6
+#define NEOM8X_EMULATOR_NAV_PVT_PAYLOAD_SIZE_BYTES  92
+#define NEOM8X_EMULATOR_CFG_NAVX5_PAYLOAD_SIZE_BYTES    40
+#define NEOM8X_EMULATOR_CFG_NAVX5_MASK1_ACK_AIDING      0x0400
+#define NEOM8X_EMULATOR_CFG_NAVX5_ACK_AIDING_OFFSET     17
+#define NEOM8X_EMULATOR_MGA_ACK_PAYLOAD_SIZE_BYTES      8
+#define NEOM8X_EMULATOR_MGA_ACK_INFO_NO_TIME            1
+#define NEOM8X_EMULATOR_MGA_INI_TYPE_POS_XYZ            0x00
+#define NEOM8X_EMULATOR_MGA_INI_TYPE_POS_LLH            0x01
+#define NEOM8X_EMULATOR_MGA_INI_TYPE_TIME_UTC           0x10
+#define NEOM8X_EMULATOR_MGA_INI_TYPE_TIME_GNSS          0x11
+#define NEOM8X_EMULATOR_AIDING_ORBIT_COUNT_MIN          4
+#define NEOM8X_EMULATOR_AIDED_TTFF_MS                   3000
+#define NEOM8X_EMULATOR_AIDED_TTFF_NO_POSITION_MS       5000
+#define NEOM8X_EMULATOR_CFG_RST_PAYLOAD_SIZE_BYTES      4
+#define NEOM8X_EMULATOR_CFG_RST_MODE_GNSS_STOP          0x08
+#define NEOM8X_EMULATOR_CFG_RST_MODE_GNSS_START         0x09
+#define NEOM8X_EMULATOR_UPD_SOS_COMMAND_SIZE_BYTES      4
+#define NEOM8X_EMULATOR_UPD_SOS_RESPONSE_SIZE_BYTES     8
+#define NEOM8X_EMULATOR_UPD_SOS_CMD_CREATE_BACKUP       0x00
+#define NEOM8X_EMULATOR_UPD_SOS_CMD_CLEAR_BACKUP        0x01
+#define NEOM8X_EMULATOR_UPD_SOS_CMD_BACKUP_ACK          0x02
+#define NEOM8X_EMULATOR_UPD_SOS_CMD_RESTORED            0x03
+#define NEOM8X_EMULATOR_UPD_SOS_RESTORED                2
+#define NEOM8X_EMULATOR_UPD_SOS_NO_BACKUP               3
+#define NEOM8X_EMULATOR_HOT_START_TTFF_MS               1000
+#define NEOM8X_EMULATOR_CFG_PM2_PAYLOAD_SIZE_BYTES      44
+#define NEOM8X_EMULATOR_CFG_PM2_V2_PAYLOAD_SIZE_BYTES   48
+#define NEOM8X_EMULATOR_CFG_PM2_FLAGS_OFFSET            4
+#define NEOM8X_EMULATOR_CFG_PM2_UPDATE_PERIOD_OFFSET    8
+#define NEOM8X_EMULATOR_CFG_PM2_MODE_SHIFT              17
+#define NEOM8X_EMULATOR_CFG_PM2_MODE_MASK               0x03
+#define NEOM8X_EMULATOR_CFG_PM2_UPDATE_PERIOD_DEFAULT   1000
+#define NEOM8X_EMULATOR_CFG_RXM_PAYLOAD_SIZE_BYTES      2
+#define NEOM8X_EMULATOR_RXM_PMREQ_PAYLOAD_SIZE_BYTES    8
+#define NEOM8X_EMULATOR_RXM_PMREQ_V0_PAYLOAD_SIZE_BYTES 16
+#define NEOM8X_EMULATOR_RXM_PMREQ_FLAG_BACKUP           0x00000002
+
+#define NEOM8X_EMULATOR_PROTOCOL_UBX                0x01
+#define NEOM8X_EMULATOR_PROTOCOL_NMEA               0x02
+#define NEOM8X_EMULATOR_PROTOCOL_ALL                0x07
+
+#define NEOM8X_EMULATOR_MEASUREMENT_PERIOD_MIN_MS   25
+#define NEOM8X_EMULATOR_GEOID_SEPARATION_MM         48000
+#define NEOM8X_EMULATOR_NUMBER_OF_SATELLITES        8
+
+/*** NEOM8X EMULATOR local structures ***/
+
+/*******************************************************************/
+typedef enum {
+    NEOM8X_EMULATOR_NMEA_ID_GGA = 0x00,
+    NEOM8X_EMULATOR_NMEA_ID_GLL = 0x01,
+    NEOM8X_EMULATOR_NMEA_ID_GSA = 0x02,
+    NEOM8X_EMULATOR_NMEA_ID_GSV = 0x03,
+    NEOM8X_EMULATOR_NMEA_ID_RMC = 0x04,
+    NEOM8X_EMULATOR_NMEA_ID_VTG = 0x05,
+    NEOM8X_EMULATOR_NMEA_ID_GRS = 0x06,
+    NEOM8X_EMULATOR_NMEA_ID_GST = 0x07,
+    NEOM8X_EMULATOR_NMEA_ID_ZDA = 0x08,
+    NEOM8X_EMULATOR_NMEA_ID_GBS = 0x09,
+    NEOM8X_EMULATOR_NMEA_ID_DTM = 0x0A,
+    NEOM8X_EMULATOR_NMEA_ID_GNS = 0x0D,
+    NEOM8X_EMULATOR_NMEA_ID_THS = 0x0E,
+    NEOM8X_EMULATOR_NMEA_ID_VLW = 0x0F,
+    NEOM8X_EMULATOR_NMEA_ID_LAST
+} NEOM8X_EMULATOR_nmea_id_t;
+
+/*******************************************************************/
+typedef struct {
+    NEOM8X_time_t time;
+    uint8_t centiseconds;
+    uint8_t fix_flag;
+    int32_t altitude_mm;
+} NEOM8X_EMULATOR_epoch_t;
+
+/*******************************************************************/
+typedef struct {
+    NEOM8X_EMULATOR_configuration_t configuration;
+    // Host interface.
+    NEOM8X_HW_rx_irq_cb_t rx_irq_callback;
+#ifdef NEOM8X_DRIVER_RX_BLOCK
+    NEOM8X_HW_rx_block_cb_t rx_block_callback;
+    uint8_t rx_block[NEOM8X_EMULATOR_RX_BLOCK_SIZE_MAX_BYTES];
+    uint32_t rx_block_size;
+#endif
+    NEOM8X_HW_timer_irq_cb_t timer_irq_callback;
+    uint32_t host_baud_rate;
+    uint8_t rx_enabled_flag;
+    uint8_t timer_armed_flag;
+    uint64_t timer_deadline_ns;
+    uint8_t backup_voltage_state;
+    // Receiver configuration.
+    uint32_t uart_baud_rate;
+    uint16_t output_protocol_mask;
+    uint16_t measurement_period_ms;
+    uint8_t nmea_rate[NEOM8X_EMULATOR_NMEA_ID_LAST];
+    uint8_t nav_pvt_rate;
+    uint8_t ack_aiding_flag;
+    uint8_t low_power_flag;
+    uint32_t power_save_period_ms;
+    // Navigation state.
+    uint64_t first_fix_ms;
+    uint8_t aiding_time_flag;
+    uint8_t aiding_position_flag;
+    uint32_t aiding_orbit_count;
+    uint8_t gnss_running_flag;
+    uint8_t backup_restore_status;
+    uint8_t backup_mode_flag;
+    uint64_t next_update_ms;
+    // Virtual time.
+    uint64_t time_ns;
+    uint64_t next_epoch_ns;
+    uint64_t line_free_ns;
+    uint32_t epoch_idx;
+    // Transmission FIFO.
+    uint8_t tx_buffer[NEOM8X_EMULATOR_TX_BUFFER_SIZE_BYTES];
+    uint32_t tx_write_idx;
+    uint32_t tx_read_idx;
+    // Capture replay.
+    char_t* capture_data;
+    char_t** capture_lines;
+    uint32_t capture_line_count;
+    uint32_t capture_line_idx;
+    // Impairments.
+    uint32_t prng_state;
+    NEOM8X_EMULATOR_statistics_t statistics;
+} NEOM8X_EMULATOR_context_t;
+
+/*** NEOM8X EMULATOR local global variables ***/
+
+static const char_t* const NEOM8X_EMULATOR_NMEA_NAME[NEOM8X_EMULATOR_NMEA_ID_LAST] = {
+    "GGA", "GLL", "GSA", "GSV", "RMC", "VTG", "GRS", "GST", "ZDA", "GBS", "DTM", NULL, NULL, "GNS", "THS", "VLW"
+};
+
+static NEOM8X_EMULATOR_context_t neom8x_emulator_ctx;
+
+/*** NEOM8X EMULATOR local functions ***/
+
+/*******************************************************************/
+static uint32_t _NEOM8X_EMULATOR_random(void) {
+    // Xorshift generator: the same seed always gives the same impairments.
+    neom8x_emulator_ctx.prng_state ^= (neom8x_emulator_ctx.prng_state << 13);
+    neom8x_emulator_ctx.prng_state ^= (neom8x_emulator_ctx.prng_state >> 17);
+    neom8x_emulator_ctx.prng_state ^= (neom8x_emulator_ctx.prng_state << 5);
+    return neom8x_emulator_ctx.prng_state;
+}
+
+/*******************************************************************/
+static uint64_t _NEOM8X_EMULATOR_get_byte_duration_ns(void) {
+    return ((NEOM8X_EMULATOR_UART_FRAME_SIZE_BITS * 1000000000ULL) / neom8x_emulator_ctx.uart_baud_rate);
+}
+
+/*******************************************************************/
+static void _NEOM8X_EMULATOR_push_byte(uint8_t tx_byte) {
+    // Check FIFO level.
+    if ((neom8x_emulator_ctx.tx_write_idx - neom8x_emulator_ctx.tx_read_idx) >= NEOM8X_EMULATOR_TX_BUFFER_SIZE_BYTES) {
+        neom8x_emulator_ctx.statistics.tx_byte_lost_count++;
+        return;
+    }
+    // Line becomes busy now if it was idle.
+    if ((neom8x_emulator_ctx.tx_write_idx == neom8x_emulator_ctx.tx_read_idx) && (neom8x_emulator_ctx.line_free_ns < neom8x_emulator_ctx.time_ns)) {
+        neom8x_emulator_ctx.line_free_ns = neom8x_emulator_ctx.time_ns;
+    }
+    neom8x_emulator_ctx.tx_buffer[neom8x_emulator_ctx.tx_write_idx % NEOM8X_EMULATOR_TX_BUFFER_SIZE_BYTES] = tx_byte;
+    neom8x_emulator_ctx.tx_write_idx++;
+}
+
+/*******************************************************************/
+static void _NEOM8X_EMULATOR_send_nmea(const char_t* body) {
+    // Local variables.
+    char_t checksum_str[8];
+    uint8_t checksum = 0;
+    uint32_t idx = 0;
+    // Check output protocol.
+    if ((neom8x_emulator_ctx.output_protocol_mask & NEOM8X_EMULATOR_PROTOCOL_NMEA) == 0) return;
+    // Compute checksum.
+    for (idx = 0; body[idx] != '\0'; idx++) {
+        checksum ^= (uint8_t) body[idx];
+    }
+    snprintf(checksum_str, sizeof(checksum_str), "*%02X\r\n", checksum);
+    // Queue sentence.
+    _NEOM8X_EMULATOR_push_byte('$');
+    for (idx = 0; body[idx] != '\0'; idx++) {
+        _NEOM8X_EMULATOR_push_byte((uint8_t) body[idx]);
+    }
+    for (idx = 0; checksum_str[idx] != '\0'; idx++) {
+        _NEOM8X_EMULATOR_push_byte((uint8_t) checksum_str[idx]);
+    }
+}
+
+/*******************************************************************/
+static void _NEOM8X_EMULATOR_send_ubx(uint8_t message_class, uint8_t message_id, uint8_t* payload, uint16_t payload_size) {
+    // Local variables.
+    uint8_t header[4] = { message_class, message_id, (uint8_t) (payload_size & 0xFF), (uint8_t) (payload_size >> 8) };
+    uint8_t ck_a = 0;
+    uint8_t ck_b = 0;
+    uint16_t idx = 0;
+    // Check output protocol.
+    if ((neom8x_emulator_ctx.output_protocol_mask & NEOM8X_EMULATOR_PROTOCOL_UBX) == 0) return;
+    // Queue frame.
+    _NEOM8X_EMULATOR_push_byte(NEOM8X_EMULATOR_UBX_SYNC_CHAR_1);
+    _NEOM8X_EMULATOR_push_byte(NEOM8X_EMULATOR_UBX_SYNC_CHAR_2);
+    for (idx = 0; idx < sizeof(header); idx++) {
+        _NEOM8X_EMULATOR_push_byte(header[idx]);
+        ck_a = (uint8_t) (ck_a + header[idx]);
+        ck_b = (uint8_t) (ck_b + ck_a);
+    }
+    for (idx = 0; idx < payload_size; idx++) {
+        _NEOM8X_EMULATOR_push_byte(payload[idx]);
+        ck_a = (uint8_t) (ck_a + payload[idx]);
+        ck_b = (uint8_t) (ck_b + ck_a);
+    }
+    _NEOM8X_EMULATOR_push_byte(ck_a);
+    _NEOM8X_EMULATOR_push_byte(ck_b);
+}
+
+/*******************************************************************/
+static void _NEOM8X_EMULATOR_send_ack(uint8_t message_class, uint8_t message_id, uint8_t ack_flag) {
+    // Local variables.
+    uint8_t payload[2] = { message_class, message_id };
+    // Send ACK-ACK or ACK-NAK.
+    _NEOM8X_EMULATOR_send_ubx(NEOM8X_EMULATOR_UBX_CLASS_ACK, ((ack_flag != 0) ? NEOM8X_EMULATOR_UBX_ID_ACK_ACK : NEOM8X_EMULATOR_UBX_ID_ACK_NAK), payload, sizeof(payload));
+}
+
+/*******************************************************************/
+static void _NEOM8X_EMULATOR_write_u16(uint8_t* data, uint16_t value) {
+    data[0] = (uint8_t) (value >> 0);
+    data[1] = (uint8_t) (value >> 8);
+}
+
+/*******************************************************************/
+static void _NEOM8X_EMULATOR_write_u32(uint8_t* data, uint32_t value) {
+    data[0] = (uint8_t) (value >> 0);
+    data[1] = (uint8_t) (value >> 8);
+    data[2] = (uint8_t) (value >> 16);
+    data[3] = (uint8_t) (value >> 24);
+}
+
+/*******************************************************************/
+static uint32_t _NEOM8X_EMULATOR_read_u32(uint8_t* data) {
+    return ((uint32_t) data[0] | ((uint32_t) data[1] << 8) | ((uint32_t) data[2] << 16) | ((uint32_t) data[3] << 24));
+}
+
+/*******************************************************************/
+static void _NEOM8X_EMULATOR_send_boot_banner(void) {
+    // Receiver prints its identification after each reset.
+    _NEOM8X_EMULATOR_send_nmea("GNTXT,01,01,02,u-blox AG - www.u-blox.com");
+    _NEOM8X_EMULATOR_send_nmea("GNTXT,01,01,02,HW UBX-M8035 00080000");
+}
+
+/*******************************************************************/
+static void _NEOM8X_EMULATOR_apply_factory_configuration(void) {
+    // Local variables.
+    uint8_t idx = 0;
+    // Default port and navigation settings.
+    neom8x_emulator_ctx.uart_baud_rate = neom8x_emulator_ctx.configuration.uart_baud_rate;
+    neom8x_emulator_ctx.output_protocol_mask = (NEOM8X_EMULATOR_PROTOCOL_UBX | NEOM8X_EMULATOR_PROTOCOL_NMEA);
+    neom8x_emulator_ctx.measurement_period_ms = neom8x_emulator_ctx.configuration.measurement_period_ms;
+    // Default NMEA output (GGA, GLL, GSA, GSV, RMC and VTG).
+    for (idx = 0; idx < NEOM8X_EMULATOR_NMEA_ID_LAST; idx++) {
+        neom8x_emulator_ctx.nmea_rate[idx] = (idx <= NEOM8X_EMULATOR_NMEA_ID_VTG) ? 1 : 0;
+    }
+    neom8x_emulator_ctx.nav_pvt_rate = 0;
+    neom8x_emulator_ctx.ack_aiding_flag = 0;
+    neom8x_emulator_ctx.gnss_running_flag = 1;
+    neom8x_emulator_ctx.low_power_flag = 0;
+    neom8x_emulator_ctx.power_save_period_ms = NEOM8X_EMULATOR_CFG_PM2_UPDATE_PERIOD_DEFAULT;
+    neom8x_emulator_ctx.backup_mode_flag = 0;
+    // Flush transmission and restart measurements.
+    neom8x_emulator_ctx.tx_read_idx = neom8x_emulator_ctx.tx_write_idx;
+    neom8x_emulator_ctx.next_epoch_ns = neom8x_emulator_ctx.time_ns + (neom8x_emulator_ctx.measurement_period_ms * NEOM8X_EMULATOR_NS_PER_MS);
+    neom8x_emulator_ctx.epoch_idx = 0;
+}
+
+/*******************************************************************/
+static int32_t _NEOM8X_EMULATOR_days_from_civil(int32_t year, uint32_t month, uint32_t date) {
+    // Local variables.
+    int32_t era = 0;
+    uint32_t yoe = 0;
+    uint32_t doy = 0;
+    uint32_t doe = 0;
+    // Proleptic gregorian calendar, days since 1970-01-01.
+    year -= (month <= 2) ? 1 : 0;
+    era = ((year >= 0) ? year : (year - 399)) / 400;
+    yoe = (uint32_t) (year - (era * 400));
+    doy = (((153 * ((month > 2) ? (month - 3) : (month + 9))) + 2) / 5) + date - 1;
+    doe = (yoe * 365) + (yoe / 4) - (yoe / 100) + doy;
+    return ((era * 146097) + (int32_t) doe - 719468);
+}
+
+/*******************************************************************/
+static void _NEOM8X_EMULATOR_civil_from_days(int32_t days, NEOM8X_time_t* gps_time) {
+    // Local variables.
+    int32_t era = 0;
+    uint32_t doe = 0;
+    uint32_t yoe = 0;
+    uint32_t doy = 0;
+    uint32_t mp = 0;
+    uint32_t month = 0;
+    // Inverse of the days computation.
+    days += 719468;
+    era = ((days >= 0) ? days : (days - 146096)) / 146097;
+    doe = (uint32_t) (days - (era * 146097));
+    yoe = (doe - (doe / 1460) + (doe / 36524) - (doe / 146096)) / 365;
+    doy = doe - ((365 * yoe) + (yoe / 4) - (yoe / 100));
+    mp = ((5 * doy) + 2) / 153;
+    month = (mp < 10) ? (mp + 3) : (mp - 9);
+    (gps_time->date) = (uint8_t) (doy - (((153 * mp) + 2) / 5) + 1);
+    (gps_time->month) = (uint8_t) month;
+    (gps_time->year) = (uint16_t) ((int32_t) yoe + (era * 400) + ((month <= 2) ? 1 : 0));
+}
+
+/*******************************************************************/
+static void _NEOM8X_EMULATOR_compute_epoch(NEOM8X_EMULATOR_epoch_t* epoch) {
+    // Local variables.
+    NEOM8X_time_t* start_time = &(neom8x_emulator_ctx.configuration.start_time);
+    uint64_t time_ms = (neom8x_emulator_ctx.time_ns / NEOM8X_EMULATOR_NS_PER_MS);
+    uint64_t time_cs = 0;
+    int32_t days = 0;
+    uint32_t jitter_mm = neom8x_emulator_ctx.configuration.altitude_jitter_mm;
+    // Date and time.
+    time_cs = ((((start_time->hours) * 3600ULL) + ((start_time->minutes) * 60ULL) + (start_time->seconds)) * 100ULL) + (neom8x_emulator_ctx.time_ns / NEOM8X_EMULATOR_NS_PER_CS);
+    days = _NEOM8X_EMULATOR_days_from_civil((start_time->year), (start_time->month), (start_time->date)) + (int32_t) (time_cs / NEOM8X_EMULATOR_CS_PER_DAY);
+    time_cs %= NEOM8X_EMULATOR_CS_PER_DAY;
+    _NEOM8X_EMULATOR_civil_from_days(days, &(epoch->time));
+    epoch->time.hours = (uint8_t) (time_cs / 360000);
+    epoch->time.minutes = (uint8_t) ((time_cs / 6000) % 60);
+    epoch->time.seconds = (uint8_t) ((time_cs / 100) % 60);
+    epoch->centiseconds = (uint8_t) (time_cs % 100);
+    // Fix status.
+    epoch->fix_flag = (time_ms >= neom8x_emulator_ctx.first_fix_ms) ? 1 : 0;
+    if ((neom8x_emulator_ctx.configuration.outage_duration_ms != 0) &&
+        (time_ms >= neom8x_emulator_ctx.configuration.outage_start_ms) &&
+        (time_ms < ((uint64_t) neom8x_emulator_ctx.configuration.outage_start_ms + neom8x_emulator_ctx.configuration.outage_duration_ms)))
+    {
+        epoch->fix_flag = 0;
+    }
+    // Altitude noise.
+    epoch->altitude_mm = neom8x_emulator_ctx.configuration.altitude_mm;
+    if (jitter_mm != 0) {
+        epoch->altitude_mm += (int32_t) (_NEOM8X_EMULATOR_random() % ((2 * jitter_mm) + 1)) - (int32_t) jitter_mm;
+    }
+}
+
+/*******************************************************************/
+static void _NEOM8X_EMULATOR_format_coordinate(char_t* str, size_t size, int32_t coordinate_e7, int degrees_digits, char_t positive_char, char_t negative_char) {
+    // Local variables.
+    uint32_t absolute_e7 = (uint32_t) ((coordinate_e7 < 0) ? -((int64_t) coordinate_e7) : coordinate_e7);
+    uint32_t minutes_e5 = (uint32_t) ((((uint64_t) (absolute_e7 % 10000000)) * 6) / 10);
+    // NMEA format is <d>mm.mmmmm,<N/S/E/W>.
+    snprintf(str, size, "%0*u%02u.%05u,%c", degrees_digits, (absolute_e7 / 10000000), (minutes_e5 / 100000), (minutes_e5 % 100000), ((coordinate_e7 < 0) ? negative_char : positive_char));
+}
+
+/*******************************************************************/
+static uint8_t _NEOM8X_EMULATOR_is_message_scheduled(uint8_t nmea_id) {
+    // Local variables.
+    uint8_t rate = neom8x_emulator_ctx.nmea_rate[nmea_id];
+    // Rate is expressed in number of epochs.
+    return (((rate != 0) && ((neom8x_emulator_ctx.epoch_idx % rate) == 0)) ? 1 : 0);
+}
+
+/*******************************************************************/
+static void _NEOM8X_EMULATOR_send_synthetic_epoch(NEOM8X_EMULATOR_epoch_t* epoch) {
+    // Local variables.
+    NEOM8X_EMULATOR_configuration_t* configuration = &(neom8x_emulator_ctx.configuration);
+    char_t sentence[NEOM8X_EMULATOR_SENTENCE_SIZE_BYTES];
+    char_t time_str[16];
+    char_t lat_str[24];
+    char_t long_str[24];
+    char_t alt_str[16];
+    uint32_t alt_abs_mm = (uint32_t) ((epoch->altitude_mm < 0) ? -(epoch->altitude_mm) : epoch->altitude_mm);
+    // Common fields.
+    snprintf(time_str, sizeof(time_str), "%02u%02u%02u.%02u", epoch->time.hours, epoch->time.minutes, epoch->time.seconds, epoch->centiseconds);
+    _NEOM8X_EMULATOR_format_coordinate(lat_str, sizeof(lat_str), configuration->latitude_e7, 2, 'N', 'S');
+    _NEOM8X_EMULATOR_format_coordinate(long_str, sizeof(long_str), configuration->longitude_e7, 3, 'E', 'W');
+    snprintf(alt_str, sizeof(alt_str), "%s%u.%u", ((epoch->altitude_mm < 0) ? "-" : ""), (alt_abs_mm / 1000), ((alt_abs_mm % 1000) / 100));
+    // Messages are sent in the receiver order.
+    if (_NEOM8X_EMULATOR_is_message_scheduled(NEOM8X_EMULATOR_NMEA_ID_RMC) != 0) {
+        if (epoch->fix_flag != 0) {
+            snprintf(sentence, sizeof(sentence), "GNRMC,%s,A,%s,%s,0.012,,%02u%02u%02u,,,A", time_str, lat_str, long_str, epoch->time.date, epoch->time.month, (epoch->time.year % 100));
+        }
+        else {
+            snprintf(sentence, sizeof(sentence), "GNRMC,,V,,,,,,,,,,N");
+        }
+        _NEOM8X_EMULATOR_send_nmea(sentence);
+    }
+    if (_NEOM8X_EMULATOR_is_message_scheduled(NEOM8X_EMULATOR_NMEA_ID_VTG) != 0) {
+        _NEOM8X_EMULATOR_send_nmea((epoch->fix_flag != 0) ? "GNVTG,,T,,M,0.012,N,0.022,K,A" : "GNVTG,,,,,,,,,N");
+    }
+    if (_NEOM8X_EMULATOR_is_message_scheduled(NEOM8X_EMULATOR_NMEA_ID_GGA) != 0) {
+        if (epoch->fix_flag != 0) {
+            snprintf(sentence, sizeof(sentence), "GNGGA,%s,%s,%s,1,%02u,1.01,%s,M,48.0,M,,", time_str, lat_str, long_str, NEOM8X_EMULATOR_NUMBER_OF_SATELLITES, alt_str);
+        }
+        else {
+            snprintf(sentence, sizeof(sentence), "GNGGA,,,,,,0,00,99.99,,,,,,");
+        }
+        _NEOM8X_EMULATOR_send_nmea(sentence);
+    }
+    if (_NEOM8X_EMULATOR_is_message_scheduled(NEOM8X_EMULATOR_NMEA_ID_GSA) != 0) {
+        _NEOM8X_EMULATOR_send_nmea((epoch->fix_flag != 0) ? "GNGSA,A,3,05,13,15,18,20,21,25,29,,,,,1.80,1.01,1.49" : "GNGSA,A,1,,,,,,,,,,,,,99.99,99.99,99.99");
+    }
+    if (_NEOM8X_EMULATOR_is_message_scheduled(NEOM8X_EMULATOR_NMEA_ID_GSV) != 0) {
+        _NEOM8X_EMULATOR_send_nmea((epoch->fix_flag != 0) ? "GPGSV,2,1,08,05,43,227,32,13,60,070,38,15,41,286,35,18,12,043,29" : "GPGSV,1,1,00");
+        if (epoch->fix_flag != 0) {
+            _NEOM8X_EMULATOR_send_nmea("GPGSV,2,2,08,20,25,120,31,21,67,310,40,25,18,190,27,29,33,095,36");
+        }
+    }
+    if (_NEOM8X_EMULATOR_is_message_scheduled(NEOM8X_EMULATOR_NMEA_ID_GLL) != 0) {
+        if (epoch->fix_flag != 0) {
+            snprintf(sentence, sizeof(sentence), "GNGLL,%s,%s,%s,A,A", lat_str, long_str, time_str);
+        }
+        else {
+            snprintf(sentence, sizeof(sentence), "GNGLL,,,,,,V,N");
+        }
+        _NEOM8X_EMULATOR_send_nmea(sentence);
+    }
+    if (_NEOM8X_EMULATOR_is_message_scheduled(NEOM8X_EMULATOR_NMEA_ID_ZDA) != 0) {
+        if (epoch->fix_flag != 0) {
+            snprintf(sentence, sizeof(sentence), "GNZDA,%s,%02u,%02u,%04u,00,00", time_str, epoch->time.date, epoch->time.month, epoch->time.year);
+        }
+        else {
+            snprintf(sentence, sizeof(sentence), "GNZDA,,,,,00,00");
+        }
+        _NEOM8X_EMULATOR_send_nmea(sentence);
+    }
+}
+
+/*******************************************************************/
+static void _NEOM8X_EMULATOR_send_nav_pvt(NEOM8X_EMULATOR_epoch_t* epoch) {
+    // Local variables.
+    uint8_t payload[NEOM8X_EMULATOR_NAV_PVT_PAYLOAD_SIZE_BYTES];
+    uint32_t day_ms = 0;
+    int32_t days = 0;
+    // Check rate.
+    if ((neom8x_emulator_ctx.nav_pvt_rate == 0) || ((neom8x_emulator_ctx.epoch_idx % neom8x_emulator_ctx.nav_pvt_rate) != 0)) return;
+    memset(payload, 0, sizeof(payload));
+    // Time of week (GPS epoch is a sunday: 1980-01-06).
+    days = _NEOM8X_EMULATOR_days_from_civil(epoch->time.year, epoch->time.month, epoch->time.date) - _NEOM8X_EMULATOR_days_from_civil(1980, 1, 6);
+    day_ms = ((((epoch->time.hours * 3600) + (epoch->time.minutes * 60) + epoch->time.seconds) * 1000) + (epoch->centiseconds * 10));
+    _NEOM8X_EMULATOR_write_u32(&(payload[0]), (uint32_t) (((days % 7) * 86400000) + day_ms));
+    // Date and time.
+    _NEOM8X_EMULATOR_write_u16(&(payload[4]), epoch->time.year);
+    payload[6] = epoch->time.month;
+    payload[7] = epoch->time.date;
+    payload[8] = epoch->time.hours;
+    payload[9] = epoch->time.minutes;
+    payload[10] = epoch->time.seconds;
+    payload[11] = (epoch->fix_flag != 0) ? 0x07 : 0x00;
+    // Fix.
+    if (epoch->fix_flag != 0) {
+        payload[20] = 3;
+        payload[21] = 0x01;
+        payload[23] = NEOM8X_EMULATOR_NUMBER_OF_SATELLITES;
+        _NEOM8X_EMULATOR_write_u32(&(payload[24]), (uint32_t) neom8x_emulator_ctx.configuration.longitude_e7);
+        _NEOM8X_EMULATOR_write_u32(&(payload[28]), (uint32_t) neom8x_emulator_ctx.configuration.latitude_e7);
+        _NEOM8X_EMULATOR_write_u32(&(payload[32]), (uint32_t) (epoch->altitude_mm + NEOM8X_EMULATOR_GEOID_SEPARATION_MM));
+        _NEOM8X_EMULATOR_write_u32(&(payload[36]), (uint32_t) epoch->altitude_mm);
+        _NEOM8X_EMULATOR_write_u16(&(payload[76]), 180);
+    }
+    _NEOM8X_EMULATOR_send_ubx(NEOM8X_EMULATOR_UBX_CLASS_NAV, NEOM8X_EMULATOR_UBX_ID_NAV_PVT, payload, sizeof(payload));
+}
+
+/*******************************************************************/
+static void _NEOM8X_EMULATOR_send_capture_epoch(void) {
+    // Local variables.
+    char_t* line = NULL;
+    uint32_t line_count = 0;
+    uint8_t nmea_id = 0;
+    uint32_t idx = 0;
+    // Replay lines up to the next epoch separator.
+    for (line_count = 0; line_count < neom8x_emulator_ctx.capture_line_count; line_count++) {
+        line = neom8x_emulator_ctx.capture_lines[neom8x_emulator_ctx.capture_line_idx];
+        neom8x_emulator_ctx.capture_line_idx = ((neom8x_emulator_ctx.capture_line_idx + 1) % neom8x_emulator_ctx.capture_line_count);
+        if (line == NULL) break;
+        // Apply message rates configured by the host when the message is known.
+        if ((neom8x_emulator_ctx.output_protocol_mask & NEOM8X_EMULATOR_PROTOCOL_NMEA) == 0) continue;
+        if ((line[0] == '$') && (strlen(line) >= 6)) {
+            for (nmea_id = 0; nmea_id < NEOM8X_EMULATOR_NMEA_ID_LAST; nmea_id++) {
+                if ((NEOM8X_EMULATOR_NMEA_NAME[nmea_id] != NULL) && (strncmp(&(line[3]), NEOM8X_EMULATOR_NMEA_NAME[nmea_id], 3) == 0)) break;
+            }
+            if ((nmea_id < NEOM8X_EMULATOR_NMEA_ID_LAST) && (_NEOM8X_EMULATOR_is_message_scheduled(nmea_id) == 0)) continue;
+        }
+        // Sentences are replayed as recorded.
+        for (idx = 0; line[idx] != '\0'; idx++) {
+            _NEOM8X_EMULATOR_push_byte((uint8_t) line[idx]);
+        }
+        _NEOM8X_EMULATOR_push_byte('\r');
+        _NEOM8X_EMULATOR_push_byte('\n');
+    }
+}
+
+/*******************************************************************/
+static uint8_t _NEOM8X_EMULATOR_is_output_epoch(void) {
+    // Local variables.
+    uint64_t time_ms = (neom8x_emulator_ctx.time_ns / NEOM8X_EMULATOR_NS_PER_MS);
+    // Update power counters.
+    if (neom8x_emulator_ctx.backup_mode_flag != 0) {
+        neom8x_emulator_ctx.statistics.backup_time_ms += neom8x_emulator_ctx.measurement_period_ms;
+        return 0;
+    }
+    if (neom8x_emulator_ctx.gnss_running_flag == 0) return 0;
+    if (neom8x_emulator_ctx.low_power_flag == 0) return 1;
+    // In power save modes, a solution is only output at each update period.
+    neom8x_emulator_ctx.statistics.power_save_time_ms += neom8x_emulator_ctx.measurement_period_ms;
+    if (time_ms < neom8x_emulator_ctx.next_update_ms) return 0;
+    neom8x_emulator_ctx.next_update_ms = time_ms + neom8x_emulator_ctx.power_save_period_ms;
+    return 1;
+}
+
+/*******************************************************************/
+static void _NEOM8X_EMULATOR_process_epoch(void) {
+    // Local variables.
+    NEOM8X_EMULATOR_epoch_t epoch;
+    // Compute navigation solution.
+    _NEOM8X_EMULATOR_compute_epoch(&epoch);
+    neom8x_emulator_ctx.statistics.epoch_count++;
+    // Emulate output dropout.
+    if (_NEOM8X_EMULATOR_is_output_epoch() == 0) {
+        // No output while GNSS is stopped, in backup mode or between two power save updates.
+    }
+    else if ((_NEOM8X_EMULATOR_random() % 1000) < neom8x_emulator_ctx.configuration.dropout_permille) {
+        neom8x_emulator_ctx.statistics.dropped_epoch_count++;
+    }
+    else if (neom8x_emulator_ctx.capture_line_count != 0) {
+        _NEOM8X_EMULATOR_send_capture_epoch();
+    }
+    else {
+        _NEOM8X_EMULATOR_send_synthetic_epoch(&epoch);
+        _NEOM8X_EMULATOR_send_nav_pvt(&epoch);
+    }
+    // Schedule next epoch.
+    neom8x_emulator_ctx.epoch_idx++;
+    neom8x_emulator_ctx.next_epoch_ns += (neom8x_emulator_ctx.measurement_period_ms * NEOM8X_EMULATOR_NS_PER_MS);
+}
+
+/*******************************************************************/
+static void _NEOM8X_EMULATOR_transmit_byte(void) {
+    // Local variables.
+    uint8_t tx_byte = neom8x_emulator_ctx.tx_buffer[neom8x_emulator_ctx.tx_read_idx % NEOM8X_EMULATOR_TX_BUFFER_SIZE_BYTES];
+    // Byte is fully on the line.
+    neom8x_emulator_ctx.tx_read_idx++;
+    neom8x_emulator_ctx.line_free_ns = neom8x_emulator_ctx.time_ns;
+    neom8x_emulator_ctx.statistics.tx_byte_count++;
+    // Line noise.
+    if ((_NEOM8X_EMULATOR_random() % 1000000) < neom8x_emulator_ctx.configuration.noise_ppm) {
+        tx_byte ^= (uint8_t) (0b1 << (_NEOM8X_EMULATOR_random() % 8));
+        neom8x_emulator_ctx.statistics.corrupted_byte_count++;
+    }
+    // Baud rate mismatch only produces garbage on host side.
+    if (neom8x_emulator_ctx.host_baud_rate != neom8x_emulator_ctx.uart_baud_rate) {
+        tx_byte = (uint8_t) _NEOM8X_EMULATOR_random();
+    }
+    // Deliver byte (bytes sent while reception is stopped would still wake the host up).
+    if (neom8x_emulator_ctx.rx_enabled_flag == 0) {
+        neom8x_emulator_ctx.statistics.idle_byte_count++;
+        return;
+    }
+#ifdef NEOM8X_DRIVER_RX_BLOCK
+    if ((neom8x_emulator_ctx.configuration.rx_block_size_bytes != 0) && (neom8x_emulator_ctx.rx_block_callback != NULL)) {
+        neom8x_emulator_ctx.rx_block[neom8x_emulator_ctx.rx_block_size++] = tx_byte;
+        // Flush on full block or idle line.
+        if ((neom8x_emulator_ctx.rx_block_size >= neom8x_emulator_ctx.configuration.rx_block_size_bytes) ||
+            (neom8x_emulator_ctx.rx_block_size >= NEOM8X_EMULATOR_RX_BLOCK_SIZE_MAX_BYTES) ||
+            (neom8x_emulator_ctx.tx_write_idx == neom8x_emulator_ctx.tx_read_idx))
+        {
+            neom8x_emulator_ctx.rx_block_callback(neom8x_emulator_ctx.rx_block, neom8x_emulator_ctx.rx_block_size);
+            neom8x_emulator_ctx.rx_block_size = 0;
+        }
+        return;
+    }
+#endif
+    if (neom8x_emulator_ctx.rx_irq_callback != NULL) {
+        neom8x_emulator_ctx.rx_irq_callback(tx_byte);
+    }
+}
+
+/*******************************************************************/
+static void _NEOM8X_EMULATOR_process_cfg_prt(uint8_t* payload, uint16_t payload_size) {
+    // Local variables.
+    uint8_t response[NEOM8X_EMULATOR_CFG_PRT_PAYLOAD_SIZE_BYTES];
+    // Poll request.
+    if (payload_size <= 1) {
+        memset(response, 0, sizeof(response));
+        response[0] = NEOM8X_EMULATOR_CFG_PRT_PORT_ID_UART1;
+        _NEOM8X_EMULATOR_write_u32(&(response[4]), NEOM8X_EMULATOR_CFG_PRT_MODE_8N1);
+        _NEOM8X_EMULATOR_write_u32(&(response[8]), neom8x_emulator_ctx.uart_baud_rate);
+        _NEOM8X_EMULATOR_write_u16(&(response[12]), NEOM8X_EMULATOR_PROTOCOL_ALL);
+        _NEOM8X_EMULATOR_write_u16(&(response[14]), neom8x_emulator_ctx.output_protocol_mask);
+        _NEOM8X_EMULATOR_send_ubx(NEOM8X_EMULATOR_UBX_CLASS_CFG, NEOM8X_EMULATOR_UBX_ID_CFG_PRT, response, sizeof(response));
+        _NEOM8X_EMULATOR_send_ack(NEOM8X_EMULATOR_UBX_CLASS_CFG, NEOM8X_EMULATOR_UBX_ID_CFG_PRT, 1);
+        return;
+    }
+    if (payload_size != NEOM8X_EMULATOR_CFG_PRT_PAYLOAD_SIZE_BYTES) {
+        _NEOM8X_EMULATOR_send_ack(NEOM8X_EMULATOR_UBX_CLASS_CFG, NEOM8X_EMULATOR_UBX_ID_CFG_PRT, 0);
+        return;
+    }
+    // Only UART1 is emulated, the new settings are applied immediately (acknowledge is sent at the new baud rate).
+    if (payload[0] == NEOM8X_EMULATOR_CFG_PRT_PORT_ID_UART1) {
+        neom8x_emulator_ctx.uart_baud_rate = _NEOM8X_EMULATOR_read_u32(&(payload[8]));
+        neom8x_emulator_ctx.output_protocol_mask = (uint16_t) (payload[14] | (payload[15] << 8));
+    }
+    _NEOM8X_EMULATOR_send_ack(NEOM8X_EMULATOR_UBX_CLASS_CFG, NEOM8X_EMULATOR_UBX_ID_CFG_PRT, 1);
+}
+
+/*******************************************************************/
+static void _NEOM8X_EMULATOR_process_cfg_msg(uint8_t* payload, uint16_t payload_size) {
+    // Local variables.
+    uint8_t response[NEOM8X_EMULATOR_CFG_MSG_PAYLOAD_SIZE_BYTES];
+    uint8_t* rate = NULL;
+    // Select rate.
+    if (payload_size < 2) {
+        _NEOM8X_EMULATOR_send_ack(NEOM8X_EMULATOR_UBX_CLASS_CFG, NEOM8X_EMULATOR_UBX_ID_CFG_MSG, 0);
+        return;
+    }
+    if ((payload[0] == NEOM8X_EMULATOR_UBX_CLASS_NMEA) && (payload[1] < NEOM8X_EMULATOR_NMEA_ID_LAST)) {
+        rate = &(neom8x_emulator_ctx.nmea_rate[payload[1]]);
+    }
+    if ((payload[0] == NEOM8X_EMULATOR_UBX_CLASS_NAV) && (payload[1] == NEOM8X_EMULATOR_UBX_ID_NAV_PVT)) {
+        rate = &(neom8x_emulator_ctx.nav_pvt_rate);
+    }
+    // Poll request.
+    if (payload_size == 2) {
+        memset(response, 0, sizeof(response));
+        response[0] = payload[0];
+        response[1] = payload[1];
+        response[2 + NEOM8X_EMULATOR_CFG_PRT_PORT_ID_UART1] = (rate != NULL) ? (*rate) : 0;
+        _NEOM8X_EMULATOR_send_ubx(NEOM8X_EMULATOR_UBX_CLASS_CFG, NEOM8X_EMULATOR_UBX_ID_CFG_MSG, response, sizeof(response));
+    }
+    // Rate for current port or rates for all ports (UART1 is the second one).
+    if ((payload_size == NEOM8X_EMULATOR_CFG_MSG_SHORT_SIZE_BYTES) && (rate != NULL)) {
+        (*rate) = payload[2];
+    }
+    if ((payload_size == NEOM8X_EMULATOR_CFG_MSG_PAYLOAD_SIZE_BYTES) && (rate != NULL)) {
+        (*rate) = payload[2 + NEOM8X_EMULATOR_CFG_PRT_PORT_ID_UART1];
+    }
+    _NEOM8X_EMULATOR_send_ack(NEOM8X_EMULATOR_UBX_CLASS_CFG, NEOM8X_EMULATOR_UBX_ID_CFG_MSG, 1);
+}
+
+/*******************************************************************/
+static void _NEOM8X_EMULATOR_process_cfg_rate(uint8_t* payload, uint16_t payload_size) {
+    // Local variables.
+    uint8_t response[NEOM8X_EMULATOR_CFG_RATE_PAYLOAD_SIZE_BYTES];
+    uint16_t measurement_period_ms = 0;
+    // Poll request.
+    if (payload_size == 0) {
+        memset(response, 0, sizeof(response));
+        _NEOM8X_EMULATOR_write_u16(&(response[0]), neom8x_emulator_ctx.measurement_period_ms);
+        _NEOM8X_EMULATOR_write_u16(&(response[2]), 1);
+        _NEOM8X_EMULATOR_write_u16(&(response[4]), 1);
+        _NEOM8X_EMULATOR_send_ubx(NEOM8X_EMULATOR_UBX_CLASS_CFG, NEOM8X_EMULATOR_UBX_ID_CFG_RATE, response, sizeof(response));
+        _NEOM8X_EMULATOR_send_ack(NEOM8X_EMULATOR_UBX_CLASS_CFG, NEOM8X_EMULATOR_UBX_ID_CFG_RATE, 1);
+        return;
+    }
+    // Check parameters.
+    measurement_period_ms = (uint16_t) (payload[0] | (payload[1] << 8));
+    if ((payload_size != NEOM8X_EMULATOR_CFG_RATE_PAYLOAD_SIZE_BYTES) || (measurement_period_ms < NEOM8X_EMULATOR_MEASUREMENT_PERIOD_MIN_MS)) {
+        _NEOM8X_EMULATOR_send_ack(NEOM8X_EMULATOR_UBX_CLASS_CFG, NEOM8X_EMULATOR_UBX_ID_CFG_RATE, 0);
+        return;
+    }
+    // New period is used from the next epoch.
+    neom8x_emulator_ctx.measurement_period_ms = measurement_period_ms;
+    _NEOM8X_EMULATOR_send_ack(NEOM8X_EMULATOR_UBX_CLASS_CFG, NEOM8X_EMULATOR_UBX_ID_CFG_RATE, 1);
+}
+
+/*******************************************************************/
+static void _NEOM8X_EMULATOR_process_cfg_navx5(uint8_t* payload, uint16_t payload_size) {
+    // Check parameters.
+    if (payload_size != NEOM8X_EMULATOR_CFG_NAVX5_PAYLOAD_SIZE_BYTES) {
+        _NEOM8X_EMULATOR_send_ack(NEOM8X_EMULATOR_UBX_CLASS_CFG, NEOM8X_EMULATOR_UBX_ID_CFG_NAVX5, 0);
+        return;
+    }
+    // Only the aiding acknowledge setting is emulated.
+    if (((payload[2] | (payload[3] << 8)) & NEOM8X_EMULATOR_CFG_NAVX5_MASK1_ACK_AIDING) != 0) {
+        neom8x_emulator_ctx.ack_aiding_flag = payload[NEOM8X_EMULATOR_CFG_NAVX5_ACK_AIDING_OFFSET];
+    }
+    _NEOM8X_EMULATOR_send_ack(NEOM8X_EMULATOR_UBX_CLASS_CFG, NEOM8X_EMULATOR_UBX_ID_CFG_NAVX5, 1);
+}
+
+/*******************************************************************/
+static void _NEOM8X_EMULATOR_process_mga(uint8_t message_id, uint8_t* payload, uint16_t payload_size) {
+    // Local variables.
+    uint8_t response[NEOM8X_EMULATOR_MGA_ACK_PAYLOAD_SIZE_BYTES];
+    uint8_t info_code = 0;
+    uint64_t time_ms = (neom8x_emulator_ctx.time_ns / NEOM8X_EMULATOR_NS_PER_MS);
+    uint64_t aided_fix_ms = 0;
+    // Update navigation state.
+    switch (message_id) {
+    case NEOM8X_EMULATOR_UBX_ID_MGA_INI:
+        if (payload_size == 0) break;
+        if ((payload[0] == NEOM8X_EMULATOR_MGA_INI_TYPE_TIME_UTC) || (payload[0] == NEOM8X_EMULATOR_MGA_INI_TYPE_TIME_GNSS)) {
+            neom8x_emulator_ctx.aiding_time_flag = 1;
+        }
+        if ((payload[0] == NEOM8X_EMULATOR_MGA_INI_TYPE_POS_XYZ) || (payload[0] == NEOM8X_EMULATOR_MGA_INI_TYPE_POS_LLH)) {
+            neom8x_emulator_ctx.aiding_position_flag = 1;
+        }
+        break;
+    case NEOM8X_EMULATOR_UBX_ID_MGA_GPS:
+    case NEOM8X_EMULATOR_UBX_ID_MGA_GAL:
+    case NEOM8X_EMULATOR_UBX_ID_MGA_BDS:
+    case NEOM8X_EMULATOR_UBX_ID_MGA_QZSS:
+    case NEOM8X_EMULATOR_UBX_ID_MGA_GLO:
+    case NEOM8X_EMULATOR_UBX_ID_MGA_ANO:
+        // Orbit data can not be used without time.
+        if (neom8x_emulator_ctx.aiding_time_flag == 0) {
+            info_code = NEOM8X_EMULATOR_MGA_ACK_INFO_NO_TIME;
+            break;
+        }
+        neom8x_emulator_ctx.aiding_orbit_count++;
+        break;
+    default:
+        break;
+    }
+    // Fix is obtained within a few seconds once time and enough orbits are known.
+    if ((neom8x_emulator_ctx.aiding_time_flag != 0) && (neom8x_emulator_ctx.aiding_orbit_count >= NEOM8X_EMULATOR_AIDING_ORBIT_COUNT_MIN)) {
+        aided_fix_ms = time_ms + ((neom8x_emulator_ctx.aiding_position_flag != 0) ? NEOM8X_EMULATOR_AIDED_TTFF_MS : NEOM8X_EMULATOR_AIDED_TTFF_NO_POSITION_MS);
+        if (aided_fix_ms < neom8x_emulator_ctx.first_fix_ms) {
+            neom8x_emulator_ctx.first_fix_ms = aided_fix_ms;
+        }
+    }
+    // Send MGA-ACK-DATA0 when enabled.
+    if (neom8x_emulator_ctx.ack_aiding_flag == 0) return;
+    memset(response, 0, sizeof(response));
+    response[0] = (info_code == 0) ? 1 : 0;
+    response[2] = info_code;
+    response[3] = message_id;
+    memcpy(&(response[4]), payload, (payload_size < 4) ? payload_size : 4);
+    _NEOM8X_EMULATOR_send_ubx(NEOM8X_EMULATOR_UBX_CLASS_MGA, NEOM8X_EMULATOR_UBX_ID_MGA_ACK, response, sizeof(response));
+    if (info_code != 0) {
+        neom8x_emulator_ctx.statistics.rejected_aiding_count++;
+    }
+}
+
+/*******************************************************************/
+static void _NEOM8X_EMULATOR_process_cfg_pm2(uint8_t* payload, uint16_t payload_size) {
+    // Local variables.
+    uint32_t flags = 0;
+    // Check size.
+    if ((payload_size != NEOM8X_EMULATOR_CFG_PM2_PAYLOAD_SIZE_BYTES) && (payload_size != NEOM8X_EMULATOR_CFG_PM2_V2_PAYLOAD_SIZE_BYTES)) {
+        _NEOM8X_EMULATOR_send_ack(NEOM8X_EMULATOR_UBX_CLASS_CFG, NEOM8X_EMULATOR_UBX_ID_CFG_PM2, 0);
+        return;
+    }
+    // Cyclic tracking and ON/OFF operation only differ by the current consumption, which is not emulated.
+    flags = _NEOM8X_EMULATOR_read_u32(&(payload[NEOM8X_EMULATOR_CFG_PM2_FLAGS_OFFSET]));
+    if (((flags >> NEOM8X_EMULATOR_CFG_PM2_MODE_SHIFT) & NEOM8X_EMULATOR_CFG_PM2_MODE_MASK) > 1) {
+        _NEOM8X_EMULATOR_send_ack(NEOM8X_EMULATOR_UBX_CLASS_CFG, NEOM8X_EMULATOR_UBX_ID_CFG_PM2, 0);
+        return;
+    }
+    neom8x_emulator_ctx.power_save_period_ms = _NEOM8X_EMULATOR_read_u32(&(payload[NEOM8X_EMULATOR_CFG_PM2_UPDATE_PERIOD_OFFSET]));
+    _NEOM8X_EMULATOR_send_ack(NEOM8X_EMULATOR_UBX_CLASS_CFG, NEOM8X_EMULATOR_UBX_ID_CFG_PM2, 1);
+}
+
+/*******************************************************************/
+static void _NEOM8X_EMULATOR_process_cfg_rxm(uint8_t* payload, uint16_t payload_size) {
+    // Check size.
+    if (payload_size != NEOM8X_EMULATOR_CFG_RXM_PAYLOAD_SIZE_BYTES) {
+        _NEOM8X_EMULATOR_send_ack(NEOM8X_EMULATOR_UBX_CLASS_CFG, NEOM8X_EMULATOR_UBX_ID_CFG_RXM, 0);
+        return;
+    }
+    // Byte 1 = low power mode.
+    neom8x_emulator_ctx.low_power_flag = (payload[1] != 0) ? 1 : 0;
+    neom8x_emulator_ctx.next_update_ms = (neom8x_emulator_ctx.time_ns / NEOM8X_EMULATOR_NS_PER_MS);
+    _NEOM8X_EMULATOR_send_ack(NEOM8X_EMULATOR_UBX_CLASS_CFG, NEOM8X_EMULATOR_UBX_ID_CFG_RXM, 1);
+}
+
+/*******************************************************************/
+static void _NEOM8X_EMULATOR_process_rxm_pmreq(uint8_t* payload, uint16_t payload_size) {
+    // Local variables.
+    uint32_t flags = 0;
+    // Power management request is never acknowledged.
+    if (payload_size == NEOM8X_EMULATOR_RXM_PMREQ_PAYLOAD_SIZE_BYTES) {
+        flags = _NEOM8X_EMULATOR_read_u32(&(payload[4]));
+    }
+    else if (payload_size == NEOM8X_EMULATOR_RXM_PMREQ_V0_PAYLOAD_SIZE_BYTES) {
+        flags = _NEOM8X_EMULATOR_read_u32(&(payload[8]));
+    }
+    else {
+        neom8x_emulator_ctx.statistics.ignored_command_count++;
+        return;
+    }
+    if ((flags & NEOM8X_EMULATOR_RXM_PMREQ_FLAG_BACKUP) == 0) return;
+    // Only the wake-up on UART activity is emulated, pending output is lost.
+    neom8x_emulator_ctx.backup_mode_flag = 1;
+    neom8x_emulator_ctx.tx_read_idx = neom8x_emulator_ctx.tx_write_idx;
+}
+
+/*******************************************************************/
+static void _NEOM8X_EMULATOR_process_cfg_rst(uint8_t* payload, uint16_t payload_size) {
+    // Reset command is never acknowledged.
+    if (payload_size != NEOM8X_EMULATOR_CFG_RST_PAYLOAD_SIZE_BYTES) return;
+    switch (payload[2]) {
+    case NEOM8X_EMULATOR_CFG_RST_MODE_GNSS_STOP:
+        neom8x_emulator_ctx.gnss_running_flag = 0;
+        break;
+    case NEOM8X_EMULATOR_CFG_RST_MODE_GNSS_START:
+        neom8x_emulator_ctx.gnss_running_flag = 1;
+        break;
+    default:
+        // Hardware and software resets.
+        NEOM8X_EMULATOR_reset();
+        break;
+    }
+}
+
+/*******************************************************************/
+static void _NEOM8X_EMULATOR_process_upd_sos(uint8_t* payload, uint16_t payload_size) {
+    // Local variables.
+    uint8_t response[NEOM8X_EMULATOR_UPD_SOS_RESPONSE_SIZE_BYTES];
+    memset(response, 0, sizeof(response));
+    if (payload_size == 0) {
+        // Poll request: send restore status.
+        response[0] = NEOM8X_EMULATOR_UPD_SOS_CMD_RESTORED;
+        response[4] = neom8x_emulator_ctx.backup_restore_status;
+    }
+    else if ((payload_size == NEOM8X_EMULATOR_UPD_SOS_COMMAND_SIZE_BYTES) && (payload[0] == NEOM8X_EMULATOR_UPD_SOS_CMD_CREATE_BACKUP)) {
+        // Backup can only be created when GNSS is stopped.
+        response[0] = NEOM8X_EMULATOR_UPD_SOS_CMD_BACKUP_ACK;
+        response[4] = (neom8x_emulator_ctx.gnss_running_flag == 0) ? 1 : 0;
+        if (response[4] != 0) {
+            neom8x_emulator_ctx.statistics.backup_count++;
+        }
+    }
+    else if ((payload_size == NEOM8X_EMULATOR_UPD_SOS_COMMAND_SIZE_BYTES) && (payload[0] == NEOM8X_EMULATOR_UPD_SOS_CMD_CLEAR_BACKUP)) {
+        response[0] = NEOM8X_EMULATOR_UPD_SOS_CMD_BACKUP_ACK;
+        response[4] = 1;
+    }
+    else {
+        neom8x_emulator_ctx.statistics.ignored_command_count++;
+        return;
+    }
+    _NEOM8X_EMULATOR_send_ubx(NEOM8X_EMULATOR_UBX_CLASS_UPD, NEOM8X_EMULATOR_UBX_ID_UPD_SOS, response, NEOM8X_EMULATOR_UPD_SOS_RESPONSE_SIZE_BYTES);
+}
+
+/*******************************************************************/
+static void _NEOM8X_EMULATOR_process_command(uint8_t message_class, uint8_t message_id, uint8_t* payload, uint16_t payload_size) {
+    // Aiding messages.
+    if (message_class == NEOM8X_EMULATOR_UBX_CLASS_MGA) {
+        neom8x_emulator_ctx.statistics.aiding_count++;
+        _NEOM8X_EMULATOR_process_mga(message_id, payload, payload_size);
+        return;
+    }
+    // Power management request.
+    if ((message_class == NEOM8X_EMULATOR_UBX_CLASS_RXM) && (message_id == NEOM8X_EMULATOR_UBX_ID_RXM_PMREQ)) {
+        neom8x_emulator_ctx.statistics.command_count++;
+        _NEOM8X_EMULATOR_process_rxm_pmreq(payload, payload_size);
+        return;
+    }
+    // Save on shutdown messages.
+    if ((message_class == NEOM8X_EMULATOR_UBX_CLASS_UPD) && (message_id == NEOM8X_EMULATOR_UBX_ID_UPD_SOS)) {
+        neom8x_emulator_ctx.statistics.command_count++;
+        _NEOM8X_EMULATOR_process_upd_sos(payload, payload_size);
+        return;
+    }
+    // Only configuration messages are emulated.
+    if (message_class != NEOM8X_EMULATOR_UBX_CLASS_CFG) {
+        neom8x_emulator_ctx.statistics.ignored_command_count++;
+        return;
+    }
+    neom8x_emulator_ctx.statistics.command_count++;
+    switch (message_id) {
+    case NEOM8X_EMULATOR_UBX_ID_CFG_PRT:
+        _NEOM8X_EMULATOR_process_cfg_prt(payload, payload_size);
+        break;
+    case NEOM8X_EMULATOR_UBX_ID_CFG_MSG:
+        _NEOM8X_EMULATOR_process_cfg_msg(payload, payload_size);
+        break;
+    case NEOM8X_EMULATOR_UBX_ID_CFG_RST:
+        _NEOM8X_EMULATOR_process_cfg_rst(payload, payload_size);
+        break;
+    case NEOM8X_EMULATOR_UBX_ID_CFG_RATE:
+        _NEOM8X_EMULATOR_process_cfg_rate(payload, payload_size);
+        break;
+    case NEOM8X_EMULATOR_UBX_ID_CFG_NAVX5:
+        _NEOM8X_EMULATOR_process_cfg_navx5(payload, payload_size);
+        break;
+    case NEOM8X_EMULATOR_UBX_ID_CFG_PM2:
+        _NEOM8X_EMULATOR_process_cfg_pm2(payload, payload_size);
+        break;
+    case NEOM8X_EMULATOR_UBX_ID_CFG_RXM:
+        _NEOM8X_EMULATOR_process_cfg_rxm(payload, payload_size);
+        break;
+    default:
+        // Other settings are accepted but have no effect on the emulated output.
+        _NEOM8X_EMULATOR_send_ack(message_class, message_id, 1);
+        break;
+    }
+}
+
+/*******************************************************************/
+static void _NEOM8X_EMULATOR_receive_message(uint8_t* message, uint32_t message_size_bytes) {
+    // Local variables.
+    uint32_t idx = 0;
+    uint32_t ck_idx = 0;
+    uint16_t payload_size = 0;
+    uint8_t ck_a = 0;
+    uint8_t ck_b = 0;
+    // Any activity wakes the receiver up from backup mode: the message is lost and the receiver restarts with a hot start.
+    if (neom8x_emulator_ctx.backup_mode_flag != 0) {
+        neom8x_emulator_ctx.statistics.ignored_command_count++;
+        neom8x_emulator_ctx.first_fix_ms = (neom8x_emulator_ctx.time_ns / NEOM8X_EMULATOR_NS_PER_MS) + NEOM8X_EMULATOR_HOT_START_TTFF_MS;
+        NEOM8X_EMULATOR_reset();
+        return;
+    }
+    // Commands sent at a different baud rate are not understood.
+    if (neom8x_emulator_ctx.host_baud_rate != neom8x_emulator_ctx.uart_baud_rate) {
+        neom8x_emulator_ctx.statistics.ignored_command_count++;
+        return;
+    }
+    // Parse all UBX frames of the buffer.
+    while ((idx + NEOM8X_EMULATOR_UBX_OVERHEAD_SIZE_BYTES) <= message_size_bytes) {
+        if ((message[idx] != NEOM8X_EMULATOR_UBX_SYNC_CHAR_1) || (message[idx + 1] != NEOM8X_EMULATOR_UBX_SYNC_CHAR_2)) {
+            idx++;
+            continue;
+        }
+        payload_size = (uint16_t) (message[idx + 4] | (message[idx + 5] << 8));
+        if ((idx + NEOM8X_EMULATOR_UBX_OVERHEAD_SIZE_BYTES + payload_size) > message_size_bytes) break;
+        // Check checksum.
+        ck_a = 0;
+        ck_b = 0;
+        for (ck_idx = (idx + 2); ck_idx < (idx + NEOM8X_EMULATOR_UBX_PAYLOAD_OFFSET + payload_size); ck_idx++) {
+            ck_a = (uint8_t) (ck_a + message[ck_idx]);
+            ck_b = (uint8_t) (ck_b + ck_a);
+        }
+        if ((message[ck_idx] == ck_a) && (message[ck_idx + 1] == ck_b)) {
+            _NEOM8X_EMULATOR_process_command(message[idx + 2], message[idx + 3], &(message[idx + NEOM8X_EMULATOR_UBX_PAYLOAD_OFFSET]), payload_size);
+        }
+        else {
+            neom8x_emulator_ctx.statistics.ignored_command_count++;
+        }
+        idx += (NEOM8X_EMULATOR_UBX_OVERHEAD_SIZE_BYTES + payload_size);
+    }
+}
+
+/*******************************************************************/
+static int _NEOM8X_EMULATOR_load_capture(const char_t* capture_path) {
+    // Local variables.
+    FILE* capture_file = NULL;
+    long capture_size = 0;
+    char_t* line = NULL;
+    char_t* next_line = NULL;
+    size_t line_size = 0;
+    uint32_t line_count = 0;
+    int status = -1;
+    // Read whole file.
+    capture_file = fopen(capture_path, "rb");
+    if (capture_file == NULL) goto errors;
+    if (fseek(capture_file, 0, SEEK_END) != 0) goto errors;
+    capture_size = ftell(capture_file);
+    if ((capture_size <= 0) || (fseek(capture_file, 0, SEEK_SET) != 0)) goto errors;
+    neom8x_emulator_ctx.capture_data = malloc((size_t) capture_size + 1);
+    neom8x_emulator_ctx.capture_lines = malloc(((size_t) capture_size + 1) * sizeof(char_t*));
+    if ((neom8x_emulator_ctx.capture_data == NULL) || (neom8x_emulator_ctx.capture_lines == NULL)) goto errors;
+    if (fread(neom8x_emulator_ctx.capture_data, 1, (size_t) capture_size, capture_file) != (size_t) capture_size) goto errors;
+    neom8x_emulator_ctx.capture_data[capture_size] = '\0';
+    // Split lines: comments are skipped and empty lines mark the end of an epoch.
+    for (line = neom8x_emulator_ctx.capture_data; line != NULL; line = next_line) {
+        next_line = strchr(line, '\n');
+        if (next_line != NULL) {
+            (*next_line) = '\0';
+            next_line++;
+        }
+        line_size = strcspn(line, "\r");
+        line[line_size] = '\0';
+        if (line[0] == '#') continue;
+        if (line_size == 0) {
+            if ((line_count == 0) || (neom8x_emulator_ctx.capture_lines[line_count - 1] == NULL)) continue;
+            line = NULL;
+        }
+        neom8x_emulator_ctx.capture_lines[line_count++] = line;
+    }
+    if (line_count == 0) goto errors;
+    neom8x_emulator_ctx.capture_line_count = line_count;
+    neom8x_emulator_ctx.capture_line_idx = 0;
+    status = 0;
+errors:
+    if (capture_file != NULL) {
+        fclose(capture_file);
+    }
+    return status;
+}
+
+/*** NEOM8X EMULATOR functions ***/
+
+/*******************************************************************/
+void NEOM8X_EMULATOR_get_default_configuration(NEOM8X_EMULATOR_configuration_t* configuration) {
+    // Factory settings of the receiver and a fixed location.
+    memset(configuration, 0, sizeof(NEOM8X_EMULATOR_configuration_t));
+    (configuration->uart_baud_rate) = 9600;
+    (configuration->measurement_period_ms) = 1000;
+    (configuration->start_time.year) = 2026;
+    (configuration->start_time.month) = 10;
+    (configuration->start_time.date) = 16;
+    (configuration->start_time.hours) = 8;
+    (configuration->start_time.minutes) = 27;
+    (configuration->start_time.seconds) = 0;
+    (configuration->latitude_e7) = 472852331;
+    (configuration->longitude_e7) = 85652650;
+    (configuration->altitude_mm) = 499600;
+    (configuration->time_to_first_fix_ms) = 25000;
+    (configuration->seed) = 1;
+}
+
+/*******************************************************************/
+int NEOM8X_EMULATOR_init(NEOM8X_EMULATOR_configuration_t* configuration) {
+    // Local variables.
+    int status = 0;
+    // Reset context.
+    NEOM8X_EMULATOR_de_init();
+    memset(&neom8x_emulator_ctx, 0, sizeof(neom8x_emulator_ctx));
+    memcpy(&(neom8x_emulator_ctx.configuration), configuration, sizeof(NEOM8X_EMULATOR_configuration_t));
+    neom8x_emulator_ctx.prng_state = ((configuration->seed) == 0) ? 1 : (configuration->seed);
+    neom8x_emulator_ctx.host_baud_rate = (configuration->uart_baud_rate);
+    neom8x_emulator_ctx.backup_voltage_state = 1;
+    neom8x_emulator_ctx.first_fix_ms = (configuration->time_to_first_fix_ms);
+    // Navigation data saved on shutdown is restored at boot.
+    neom8x_emulator_ctx.backup_restore_status = NEOM8X_EMULATOR_UPD_SOS_NO_BACKUP;
+    if ((configuration->backup_flag) != 0) {
+        neom8x_emulator_ctx.backup_restore_status = NEOM8X_EMULATOR_UPD_SOS_RESTORED;
+        if (neom8x_emulator_ctx.first_fix_ms > NEOM8X_EMULATOR_HOT_START_TTFF_MS) {
+            neom8x_emulator_ctx.first_fix_ms = NEOM8X_EMULATOR_HOT_START_TTFF_MS;
+        }
+    }
+    // Load capture.
+    if ((configuration->capture_path) != NULL) {
+        status = _NEOM8X_EMULATOR_load_capture(configuration->capture_path);
+        if (status != 0) goto errors;
+    }
+    // Power-on.
+    _NEOM8X_EMULATOR_apply_factory_configuration();
+    _NEOM8X_EMULATOR_send_boot_banner();
+errors:
+    return status;
+}
+
+/*******************************************************************/
+void NEOM8X_EMULATOR_de_init(void) {
+    // Release capture.
+    free(neom8x_emulator_ctx.capture_data);
+    free(neom8x_emulator_ctx.capture_lines);
+    neom8x_emulator_ctx.capture_data = NULL;
+    neom8x_emulator_ctx.capture_lines = NULL;
+    neom8x_emulator_ctx.capture_line_count = 0;
+}
+
+/*******************************************************************/
+void NEOM8X_EMULATOR_reset(void) {
+    // Configuration is not saved in flash.
+    _NEOM8X_EMULATOR_apply_factory_configuration();
+    _NEOM8X_EMULATOR_send_boot_banner();
+}
+
+/*******************************************************************/
+void NEOM8X_EMULATOR_run(uint32_t duration_ms) {
+    // Local variables.
+    uint64_t end_ns = neom8x_emulator_ctx.time_ns + (duration_ms * NEOM8X_EMULATOR_NS_PER_MS);
+    uint64_t tx_ns = 0;
+    // Process events in chronological order.
+    while (1) {
+        tx_ns = (neom8x_emulator_ctx.tx_write_idx != neom8x_emulator_ctx.tx_read_idx) ? (neom8x_emulator_ctx.line_free_ns + _NEOM8X_EMULATOR_get_byte_duration_ns()) : UINT64_MAX;
+        if ((tx_ns <= neom8x_emulator_ctx.next_epoch_ns) && (tx_ns <= end_ns) && ((neom8x_emulator_ctx.timer_armed_flag == 0) || (tx_ns <= neom8x_emulator_ctx.timer_deadline_ns))) {
+            neom8x_emulator_ctx.time_ns = tx_ns;
+            _NEOM8X_EMULATOR_transmit_byte();
+        }
+        else if ((neom8x_emulator_ctx.next_epoch_ns <= end_ns) && ((neom8x_emulator_ctx.timer_armed_flag == 0) || (neom8x_emulator_ctx.next_epoch_ns <= neom8x_emulator_ctx.timer_deadline_ns))) {
+            neom8x_emulator_ctx.time_ns = neom8x_emulator_ctx.next_epoch_ns;
+            _NEOM8X_EMULATOR_process_epoch();
+        }
+        else if ((neom8x_emulator_ctx.timer_armed_flag != 0) && (neom8x_emulator_ctx.timer_deadline_ns <= end_ns)) {
+            neom8x_emulator_ctx.time_ns = neom8x_emulator_ctx.timer_deadline_ns;
+            neom8x_emulator_ctx.timer_armed_flag = 0;
+            if (neom8x_emulator_ctx.timer_irq_callback != NULL) {
+                neom8x_emulator_ctx.timer_irq_callback();
+            }
+        }
+        else {
+            break;
+        }
+    }
+    neom8x_emulator_ctx.time_ns = end_ns;
+}
+
+/*******************************************************************/
+uint64_t NEOM8X_EMULATOR_get_time_ms(void) {
+    return (neom8x_emulator_ctx.time_ns / NEOM8X_EMULATOR_NS_PER_MS);
+}
+
+/*******************************************************************/
+void NEOM8X_EMULATOR_get_statistics(NEOM8X_EMULATOR_statistics_t* statistics) {
+    memcpy(statistics, &(neom8x_emulator_ctx.statistics), sizeof(NEOM8X_EMULATOR_statistics_t));
+}
+
+/*** NEOM8X HW functions (emulator backend) ***/
+
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_HW_init(NEOM8X_HW_configuration_t* configuration) {
+    // Connect host UART to the emulated receiver.
+    neom8x_emulator_ctx.host_baud_rate = (configuration->uart_baud_rate);
+    neom8x_emulator_ctx.rx_irq_callback = (configuration->rx_irq_callback);
+#ifdef NEOM8X_DRIVER_RX_BLOCK
+    neom8x_emulator_ctx.rx_block_callback = (configuration->rx_block_callback);
+    neom8x_emulator_ctx.rx_block_size = 0;
+#endif
+    neom8x_emulator_ctx.timer_irq_callback = (configuration->timer_irq_callback);
+    neom8x_emulator_ctx.rx_enabled_flag = 0;
+    neom8x_emulator_ctx.timer_armed_flag = 0;
+    return NEOM8X_SUCCESS;
+}
+
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_HW_de_init(void) {
+    // Disconnect host UART.
+    neom8x_emulator_ctx.rx_enabled_flag = 0;
+    neom8x_emulator_ctx.timer_armed_flag = 0;
+    return NEOM8X_SUCCESS;
+}
+
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_HW_send_message(uint8_t* message, uint32_t message_size_bytes) {
+    // Commands are processed as soon as they are sent.
+    _NEOM8X_EMULATOR_receive_message(message, message_size_bytes);
+    return NEOM8X_SUCCESS;
+}
+
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_HW_start_rx(void) {
+    neom8x_emulator_ctx.rx_enabled_flag = 1;
+    return NEOM8X_SUCCESS;
+}
+
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_HW_stop_rx(void) {
+    neom8x_emulator_ctx.rx_enabled_flag = 0;
+    return NEOM8X_SUCCESS;
+}
+
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_HW_delay_milliseconds(uint32_t delay_ms) {
+    // Blocking delays let the virtual time run.
+    NEOM8X_EMULATOR_run(delay_ms);
+    return NEOM8X_SUCCESS;
+}
+
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_HW_start_timer(uint32_t duration_ms) {
+    neom8x_emulator_ctx.timer_deadline_ns = neom8x_emulator_ctx.time_ns + (duration_ms * NEOM8X_EMULATOR_NS_PER_MS);
+    neom8x_emulator_ctx.timer_armed_flag = 1;
+    return NEOM8X_SUCCESS;
+}
+
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_HW_stop_timer(void) {
+    neom8x_emulator_ctx.timer_armed_flag = 0;
+    return NEOM8X_SUCCESS;
+}
+
+#ifdef NEOM8X_DRIVER_VBCKP_CONTROL
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_HW_set_backup_voltage(uint8_t state) {
+    neom8x_emulator_ctx.backup_voltage_state = state;
+    return NEOM8X_SUCCESS;
+}
+#endif
+
+#ifdef NEOM8X_DRIVER_VBCKP_CONTROL
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_HW_get_backup_voltage(uint8_t* state) {
+    (*state) = neom8x_emulator_ctx.backup_voltage_state;
+    return NEOM8X_SUCCESS;
+}
+#endif
@@ -0,0 +1,130 @@
+/*
+ * neom8x_emulator.h
+ *
+ *  Created on: 16 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __NEOM8X_EMULATOR_H__
+#define __NEOM8X_EMULATOR_H__
+
+#include "neom8x.h"
+#include "types.h"
+
+/*** NEOM8X EMULATOR structures ***/
+
+/*!******************************************************************
+ * \struct NEOM8X_EMULATOR_configuration_t
+ * \brief Emulated receiver configuration.
+ *******************************************************************/
+typedef struct {
+    // Module state at power-on.
+    uint32_t uart_baud_rate;
+    uint16_t measurement_period_ms;
+    // Synthetic navigation solution.
+    NEOM8X_time_t start_time;
+    int32_t latitude_e7;
+    int32_t longitude_e7;
+    int32_t altitude_mm;
+    uint32_t altitude_jitter_mm;
+    uint32_t time_to_first_fix_ms;
+    uint32_t outage_start_ms;
+    uint32_t outage_duration_ms;
+    // Navigation backup saved on shutdown present in flash at power-on (hot start).
+    uint8_t backup_flag;
+    // Capture file replayed instead of the synthetic sentences (NULL to disable).
+    const char_t* capture_path;
+    // Host reception by blocks of at most this size, flushed when the line becomes idle (0 for byte reception).
+    uint32_t rx_block_size_bytes;
+    // Line impairments.
+    uint32_t noise_ppm;
+    uint32_t dropout_permille;
+    uint32_t seed;
+} NEOM8X_EMULATOR_configuration_t;
+
+/*!******************************************************************
+ * \struct NEOM8X_EMULATOR_statistics_t
+ * \brief Emulated receiver counters.
+ *******************************************************************/
+typedef struct {
+    uint32_t tx_byte_count;
+    uint32_t idle_byte_count;
+    uint32_t tx_byte_lost_count;
+    uint32_t corrupted_byte_count;
+    uint32_t epoch_count;
+    uint32_t dropped_epoch_count;
+    uint32_t command_count;
+    uint32_t ignored_command_count;
+    uint32_t aiding_count;
+    uint32_t rejected_aiding_count;
+    uint32_t backup_count;
+    uint32_t power_save_time_ms;
+    uint32_t backup_time_ms;
+} NEOM8X_EMULATOR_statistics_t;
+
+/*** NEOM8X EMULATOR functions ***/
+
+/*!******************************************************************
+ * \fn void NEOM8X_EMULATOR_get_default_configuration(NEOM8X_EMULATOR_configuration_t* configuration)
+ * \brief Get the factory configuration of the emulated receiver.
+ * \param[in]   none
+ * \param[out]  configuration: Pointer to the configuration to fill.
+ * \retval      none
+ *******************************************************************/
+void NEOM8X_EMULATOR_get_default_configuration(NEOM8X_EMULATOR_configuration_t* configuration);
+
+/*!******************************************************************
+ * \fn int NEOM8X_EMULATOR_init(NEOM8X_EMULATOR_configuration_t* configuration)
+ * \brief Power-on the emulated receiver and reset the virtual time.
+ * \param[in]   configuration: Pointer to the emulated receiver configuration.
+ * \param[out]  none
+ * \retval      0 on success, -1 if the capture file can't be loaded.
+ *******************************************************************/
+int NEOM8X_EMULATOR_init(NEOM8X_EMULATOR_configuration_t* configuration);
+
+/*!******************************************************************
+ * \fn void NEOM8X_EMULATOR_de_init(void)
+ * \brief Release the emulated receiver resources.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void NEOM8X_EMULATOR_de_init(void);
+
+/*!******************************************************************
+ * \fn void NEOM8X_EMULATOR_reset(void)
+ * \brief Emulate a receiver reset: the factory configuration is restored and pending output is lost.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void NEOM8X_EMULATOR_reset(void);
+
+/*!******************************************************************
+ * \fn void NEOM8X_EMULATOR_run(uint32_t duration_ms)
+ * \brief Advance the virtual time, delivering bytes and timer interrupts to the driver.
+ * \param[in]   duration_ms: Virtual duration in ms.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void NEOM8X_EMULATOR_run(uint32_t duration_ms);
+
+/*!******************************************************************
+ * \fn uint64_t NEOM8X_EMULATOR_get_time_ms(void)
+ * \brief Get the virtual time elapsed since power-on.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Virtual time in ms.
+ *******************************************************************/
+uint64_t NEOM8X_EMULATOR_get_time_ms(void);
+
+/*!******************************************************************
+ * \fn void NEOM8X_EMULATOR_get_statistics(NEOM8X_EMULATOR_statistics_t* statistics)
+ * \brief Read the emulated receiver counters.
+ * \param[in]   none
+ * \param[out]  statistics: Pointer to the counters.
+ * \retval      none
+ *******************************************************************/
+void NEOM8X_EMULATOR_get_statistics(NEOM8X_EMULATOR_statistics_t* statistics);
+
+#endif /* __NEOM8X_EMULATOR_H__ */
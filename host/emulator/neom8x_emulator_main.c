@@ -0,0 +1,529 @@
+/*
+ * neom8x_emulator_main.c
+ *
+ *  Created on: 16 oct. 2026
+ *      Author: Ludo
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "neom8x.h"
+#include "neom8x_emulator.h"
+#include "types.h"
+
+/*** NEOM8X EMULATOR MAIN local macros ***/
+
+#define NEOM8X_EMULATOR_MAIN_TIMEOUT_MS_DEFAULT         120000
+#define NEOM8X_EMULATOR_MAIN_LATENCY_MS_DEFAULT         10
+#define NEOM8X_EMULATOR_MAIN_STABILITY_THRESHOLD        5
+#define NEOM8X_EMULATOR_MAIN_STABILITY_HORIZONTAL_M     10
+#define NEOM8X_EMULATOR_MAIN_STABILITY_VERTICAL_M       5
+#define NEOM8X_EMULATOR_MAIN_AIDING_CHUNK_SIZE_BYTES    512
+#define NEOM8X_EMULATOR_MAIN_AIDING_TIME_ACCURACY_S     2
+#define NEOM8X_EMULATOR_MAIN_AIDING_POSITION_ACCURACY_CM 10000
+
+/*** NEOM8X EMULATOR MAIN local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    // Scenario.
+    uint8_t gps_data;
+    NEOM8X_acquisition_mode_t mode;
+    uint16_t measurement_period_ms;
+    uint32_t uart_baud_rate;
+    uint32_t acquisition_count;
+    uint32_t timeout_ms;
+    uint32_t latency_ms;
+    uint32_t idle_ms;
+    uint32_t reset_ms;
+    uint8_t satellites_min;
+    uint8_t hdop_max;
+    uint8_t coarse_aiding_flag;
+    const char_t* aiding_path;
+    uint8_t shutdown_flag;
+#ifdef NEOM8X_DRIVER_POWER_SAVE
+    NEOM8X_power_mode_t power_mode;
+    uint32_t power_save_period_ms;
+    uint8_t sleep_on_stop;
+#endif
+    // Acquisition state.
+    volatile uint8_t process_flag;
+    NEOM8X_acquisition_status_t time_status;
+    NEOM8X_acquisition_status_t position_status;
+    uint8_t time_abort_flag;
+    uint8_t position_abort_flag;
+    uint64_t time_duration_ms;
+    uint64_t position_duration_ms;
+    uint64_t start_ms;
+} NEOM8X_EMULATOR_MAIN_context_t;
+
+/*** NEOM8X EMULATOR MAIN local global variables ***/
+
+#ifdef NEOM8X_DRIVER_SENTENCE_VIEW
+static const char_t* const NEOM8X_EMULATOR_MAIN_NMEA_MESSAGE_NAME[NEOM8X_NMEA_MESSAGE_INDEX_LAST] = {
+    "DTM", "GBQ", "GBS", "GGA", "GLL", "GLQ", "GNQ", "GNS", "GPQ", "GRS", "GSA", "GST", "GSV", "RMC", "TXT", "VLW", "VTG", "ZDA"
+};
+#endif
+
+static NEOM8X_EMULATOR_MAIN_context_t neom8x_emulator_main_ctx;
+
+/*** NEOM8X EMULATOR MAIN local functions ***/
+
+/*******************************************************************/
+static void _NEOM8X_EMULATOR_MAIN_process_callback(void) {
+    neom8x_emulator_main_ctx.process_flag = 1;
+}
+
+/*******************************************************************/
+static void _NEOM8X_EMULATOR_MAIN_completion_callback(NEOM8X_gps_data_t gps_data, NEOM8X_acquisition_status_t acquisition_status) {
+    // Local variables.
+    uint64_t duration_ms = (NEOM8X_EMULATOR_get_time_ms() - neom8x_emulator_main_ctx.start_ms);
+    // Record first occurrence of each status.
+    if ((gps_data == NEOM8X_GPS_DATA_TIME) && (acquisition_status > neom8x_emulator_main_ctx.time_status)) {
+        neom8x_emulator_main_ctx.time_status = acquisition_status;
+        neom8x_emulator_main_ctx.time_duration_ms = duration_ms;
+    }
+    if ((gps_data == NEOM8X_GPS_DATA_POSITION) && (acquisition_status > neom8x_emulator_main_ctx.position_status)) {
+        neom8x_emulator_main_ctx.position_status = acquisition_status;
+        neom8x_emulator_main_ctx.position_duration_ms = duration_ms;
+    }
+    // Failure is only reported when the driver gives up before the deadline or when the receiver configuration fails.
+    if ((gps_data == NEOM8X_GPS_DATA_TIME) && (acquisition_status == NEOM8X_ACQUISITION_STATUS_FAIL)) {
+        neom8x_emulator_main_ctx.time_abort_flag = 1;
+        neom8x_emulator_main_ctx.time_duration_ms = duration_ms;
+    }
+    if ((gps_data == NEOM8X_GPS_DATA_POSITION) && (acquisition_status == NEOM8X_ACQUISITION_STATUS_FAIL)) {
+        neom8x_emulator_main_ctx.position_abort_flag = 1;
+        neom8x_emulator_main_ctx.position_duration_ms = duration_ms;
+    }
+}
+
+#ifdef NEOM8X_DRIVER_SENTENCE_VIEW
+/*******************************************************************/
+static void _NEOM8X_EMULATOR_MAIN_sentence_callback(const NEOM8X_sentence_view_t* sentence_view) {
+    // Local variables.
+    const char_t* field = NULL;
+    uint8_t field_size_bytes = 0;
+    uint8_t field_idx = 0;
+    // Print fields directly from the driver buffer.
+    printf("[%8.3f] %s", (double) NEOM8X_EMULATOR_get_time_ms() / 1000.0, NEOM8X_EMULATOR_MAIN_NMEA_MESSAGE_NAME[sentence_view->nmea_message_index]);
+    for (field_idx = 0; field_idx < (sentence_view->number_of_fields); field_idx++) {
+        if (NEOM8X_get_sentence_field(sentence_view, field_idx, &field, &field_size_bytes) != NEOM8X_SUCCESS) break;
+        printf("%c%.*s", ((field_idx == 0) ? ' ' : '|'), (int) field_size_bytes, field);
+    }
+    printf("\r\n");
+}
+#endif
+
+#ifdef NEOM8X_DRIVER_SENTENCE_VIEW
+/*******************************************************************/
+static uint32_t _NEOM8X_EMULATOR_MAIN_parse_nmea_message_mask(char_t* list) {
+    // Local variables.
+    uint32_t nmea_message_mask = 0;
+    char_t* name = strtok(list, ",");
+    uint8_t idx = 0;
+    // Comma separated message names.
+    while (name != NULL) {
+        for (idx = 0; idx < NEOM8X_NMEA_MESSAGE_INDEX_LAST; idx++) {
+            if (strcmp(name, NEOM8X_EMULATOR_MAIN_NMEA_MESSAGE_NAME[idx]) == 0) {
+                nmea_message_mask |= (0b1 << idx);
+            }
+        }
+        name = strtok(NULL, ",");
+    }
+    return nmea_message_mask;
+}
+#endif
+
+/*******************************************************************/
+static uint8_t _NEOM8X_EMULATOR_MAIN_is_acquisition_complete(void) {
+    // Local variables.
+    NEOM8X_acquisition_status_t position_target = NEOM8X_ACQUISITION_STATUS_STABLE;
+    // Altitude is not available in RMC mode.
+    if (neom8x_emulator_main_ctx.mode == NEOM8X_ACQUISITION_MODE_NMEA_RMC) {
+        position_target = NEOM8X_ACQUISITION_STATUS_FOUND;
+    }
+    if (((neom8x_emulator_main_ctx.gps_data & NEOM8X_GPS_DATA_TIME) != 0) && (neom8x_emulator_main_ctx.time_status < NEOM8X_ACQUISITION_STATUS_FOUND) && (neom8x_emulator_main_ctx.time_abort_flag == 0)) return 0;
+    if (((neom8x_emulator_main_ctx.gps_data & NEOM8X_GPS_DATA_POSITION) != 0) && (neom8x_emulator_main_ctx.position_status < position_target) && (neom8x_emulator_main_ctx.position_abort_flag == 0)) return 0;
+    return 1;
+}
+
+/*******************************************************************/
+static void _NEOM8X_EMULATOR_MAIN_run(uint32_t duration_ms) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    uint32_t step_ms = 0;
+    // Application main loop: the driver is processed after each latency period.
+    while (duration_ms > 0) {
+        step_ms = (duration_ms < neom8x_emulator_main_ctx.latency_ms) ? duration_ms : neom8x_emulator_main_ctx.latency_ms;
+        NEOM8X_EMULATOR_run(step_ms);
+        duration_ms -= step_ms;
+        // Emulate receiver reset.
+        if ((neom8x_emulator_main_ctx.reset_ms != 0) && (NEOM8X_EMULATOR_get_time_ms() >= neom8x_emulator_main_ctx.reset_ms)) {
+            printf("[%8.3f] receiver reset\r\n", (double) NEOM8X_EMULATOR_get_time_ms() / 1000.0);
+            NEOM8X_EMULATOR_reset();
+            neom8x_emulator_main_ctx.reset_ms = 0;
+        }
+        if (neom8x_emulator_main_ctx.process_flag == 0) continue;
+        neom8x_emulator_main_ctx.process_flag = 0;
+        status = NEOM8X_process();
+        if (status != NEOM8X_SUCCESS) {
+            printf("[%8.3f] process status=%d\r\n", (double) NEOM8X_EMULATOR_get_time_ms() / 1000.0, (int) status);
+        }
+        if (_NEOM8X_EMULATOR_MAIN_is_acquisition_complete() != 0) break;
+    }
+}
+
+/*******************************************************************/
+static NEOM8X_status_t _NEOM8X_EMULATOR_MAIN_acquire(uint32_t acquisition_idx) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    NEOM8X_acquisition_t acquisition;
+    NEOM8X_time_t gps_time;
+    NEOM8X_position_extended_t gps_position_extended;
+    NEOM8X_position_t* gps_position = &(gps_position_extended.position);
+    NEOM8X_position_e7_t gps_position_e7;
+    uint64_t elapsed_ms = 0;
+    // Reset state.
+    neom8x_emulator_main_ctx.time_status = NEOM8X_ACQUISITION_STATUS_FAIL;
+    neom8x_emulator_main_ctx.position_status = NEOM8X_ACQUISITION_STATUS_FAIL;
+    neom8x_emulator_main_ctx.time_abort_flag = 0;
+    neom8x_emulator_main_ctx.position_abort_flag = 0;
+    neom8x_emulator_main_ctx.start_ms = NEOM8X_EMULATOR_get_time_ms();
+    // Start acquisition.
+    memset(&acquisition, 0, sizeof(acquisition));
+    acquisition.gps_data = neom8x_emulator_main_ctx.gps_data;
+    acquisition.mode = neom8x_emulator_main_ctx.mode;
+    acquisition.process_callback = &_NEOM8X_EMULATOR_MAIN_process_callback;
+    acquisition.completion_callback = &_NEOM8X_EMULATOR_MAIN_completion_callback;
+    acquisition.measurement_period_ms = neom8x_emulator_main_ctx.measurement_period_ms;
+    acquisition.altitude_stability_threshold = NEOM8X_EMULATOR_MAIN_STABILITY_THRESHOLD;
+    acquisition.horizontal_stability_threshold_m = NEOM8X_EMULATOR_MAIN_STABILITY_HORIZONTAL_M;
+    acquisition.vertical_stability_threshold_m = NEOM8X_EMULATOR_MAIN_STABILITY_VERTICAL_M;
+    acquisition.satellites_min = neom8x_emulator_main_ctx.satellites_min;
+    acquisition.hdop_max = neom8x_emulator_main_ctx.hdop_max;
+    acquisition.timeout_ms = neom8x_emulator_main_ctx.timeout_ms;
+#ifdef NEOM8X_DRIVER_POWER_SAVE
+    acquisition.power_mode = neom8x_emulator_main_ctx.power_mode;
+    acquisition.power_save_period_ms = neom8x_emulator_main_ctx.power_save_period_ms;
+    acquisition.sleep_on_stop = neom8x_emulator_main_ctx.sleep_on_stop;
+#endif
+    status = NEOM8X_start_acquisition(&acquisition);
+    if (status != NEOM8X_SUCCESS) goto errors;
+    // Run until completion or timeout.
+    while (_NEOM8X_EMULATOR_MAIN_is_acquisition_complete() == 0) {
+        elapsed_ms = (NEOM8X_EMULATOR_get_time_ms() - neom8x_emulator_main_ctx.start_ms);
+        if (elapsed_ms >= neom8x_emulator_main_ctx.timeout_ms) break;
+        _NEOM8X_EMULATOR_MAIN_run((uint32_t) (neom8x_emulator_main_ctx.timeout_ms - elapsed_ms));
+    }
+    status = NEOM8X_stop_acquisition();
+    if (status != NEOM8X_SUCCESS) goto errors;
+    // Print results.
+    printf("[%8.3f] acquisition %u:", (double) NEOM8X_EMULATOR_get_time_ms() / 1000.0, acquisition_idx);
+    if ((neom8x_emulator_main_ctx.gps_data & NEOM8X_GPS_DATA_TIME) != 0) {
+        NEOM8X_get_time(&gps_time);
+        printf(" time status=%u%s after %.3fs (%04u-%02u-%02u %02u:%02u:%02u)", neom8x_emulator_main_ctx.time_status,
+            ((neom8x_emulator_main_ctx.time_abort_flag != 0) ? " aborted" : ""), (double) neom8x_emulator_main_ctx.time_duration_ms / 1000.0,
+            gps_time.year, gps_time.month, gps_time.date, gps_time.hours, gps_time.minutes, gps_time.seconds);
+    }
+    if ((neom8x_emulator_main_ctx.gps_data & NEOM8X_GPS_DATA_POSITION) != 0) {
+        NEOM8X_get_position_extended(&gps_position_extended);
+        printf(" position status=%u%s after %.3fs (%02u %02u.%05u%c %03u %02u.%05u%c %um fix=%u sats=%u hdop=%u.%u)", neom8x_emulator_main_ctx.position_status,
+            ((neom8x_emulator_main_ctx.position_abort_flag != 0) ? " aborted" : ""), (double) neom8x_emulator_main_ctx.position_duration_ms / 1000.0,
+            gps_position->lat_degrees, gps_position->lat_minutes, gps_position->lat_seconds, ((gps_position->lat_north_flag != 0) ? 'N' : 'S'),
+            gps_position->long_degrees, gps_position->long_minutes, gps_position->long_seconds, ((gps_position->long_east_flag != 0) ? 'E' : 'W'), gps_position->altitude,
+            gps_position_extended.fix_quality.fix_indicator, gps_position_extended.fix_quality.number_of_satellites, (gps_position_extended.fix_quality.hdop / 10), (gps_position_extended.fix_quality.hdop % 10));
+        NEOM8X_get_position_e7(&gps_position_e7);
+        printf(" e7=(%d %d %dmm)", gps_position_e7.latitude_e7, gps_position_e7.longitude_e7, gps_position_e7.altitude_mm);
+    }
+    printf("\r\n");
+errors:
+    return status;
+}
+
+#ifdef NEOM8X_DRIVER_UBX_MGA
+/*******************************************************************/
+static NEOM8X_status_t _NEOM8X_EMULATOR_MAIN_inject_aiding(NEOM8X_EMULATOR_configuration_t* emulator_configuration) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    NEOM8X_aiding_position_t aiding_position;
+    NEOM8X_aiding_result_t aiding_result;
+    uint8_t chunk[NEOM8X_EMULATOR_MAIN_AIDING_CHUNK_SIZE_BYTES];
+    uint32_t chunk_size = 0;
+    uint32_t accepted_count = 0;
+    uint32_t rejected_count = 0;
+    uint32_t skipped_count = 0;
+    size_t read_size = 0;
+    FILE* aiding_file = NULL;
+    // Coarse time and position must be given before orbits.
+    if (neom8x_emulator_main_ctx.coarse_aiding_flag != 0) {
+        status = NEOM8X_inject_aiding_time(&(emulator_configuration->start_time), NEOM8X_EMULATOR_MAIN_AIDING_TIME_ACCURACY_S);
+        printf("[%8.3f] aiding time status=%d\r\n", (double) NEOM8X_EMULATOR_get_time_ms() / 1000.0, (int) status);
+        aiding_position.latitude_e7 = (emulator_configuration->latitude_e7);
+        aiding_position.longitude_e7 = (emulator_configuration->longitude_e7);
+        aiding_position.altitude_cm = ((emulator_configuration->altitude_mm) / 10);
+        aiding_position.accuracy_cm = NEOM8X_EMULATOR_MAIN_AIDING_POSITION_ACCURACY_CM;
+        status = NEOM8X_inject_aiding_position(&aiding_position);
+        printf("[%8.3f] aiding position status=%d\r\n", (double) NEOM8X_EMULATOR_get_time_ms() / 1000.0, (int) status);
+    }
+    if (neom8x_emulator_main_ctx.aiding_path == NULL) goto errors;
+    // Stream file by chunks, the incomplete trailing frame of each chunk being kept for the next one.
+    aiding_file = fopen(neom8x_emulator_main_ctx.aiding_path, "rb");
+    if (aiding_file == NULL) {
+        fprintf(stderr, "Unable to open aiding file %s\r\n", neom8x_emulator_main_ctx.aiding_path);
+        goto errors;
+    }
+    do {
+        read_size = fread(&(chunk[chunk_size]), 1, (sizeof(chunk) - chunk_size), aiding_file);
+        chunk_size += (uint32_t) read_size;
+        status = NEOM8X_inject_aiding_data(chunk, chunk_size, &aiding_result);
+        if (status != NEOM8X_SUCCESS) goto errors;
+        accepted_count += aiding_result.accepted_message_count;
+        rejected_count += aiding_result.rejected_message_count;
+        skipped_count += aiding_result.skipped_message_count;
+        chunk_size -= aiding_result.processed_size_bytes;
+        memmove(chunk, &(chunk[aiding_result.processed_size_bytes]), chunk_size);
+    }
+    while (read_size > 0);
+    printf("[%8.3f] aiding data: %u accepted, %u rejected, %u skipped\r\n", (double) NEOM8X_EMULATOR_get_time_ms() / 1000.0, accepted_count, rejected_count, skipped_count);
+errors:
+    if (aiding_file != NULL) {
+        fclose(aiding_file);
+    }
+    return status;
+}
+#endif
+
+/*******************************************************************/
+static void _NEOM8X_EMULATOR_MAIN_print_usage(const char_t* name) {
+    printf("Usage: %s [options]\r\n", name);
+    printf("  -d <time|position|all>  Acquired data (default all).\r\n");
+    printf("  -m <nmea|rmc|pvt>       Acquisition mode (default nmea).\r\n");
+    printf("  -p <ms>                 Measurement period (default module rate).\r\n");
+    printf("  -b <baud>               Link baud rate negotiated by the driver (default 9600).\r\n");
+    printf("  -B <bytes>              Block reception size (default byte reception).\r\n");
+    printf("  -n <count>              Number of acquisitions (default 1).\r\n");
+    printf("  -T <ms>                 Acquisition timeout (default 120000).\r\n");
+    printf("  -l <ms>                 Application loop latency (default 10).\r\n");
+    printf("  -i <ms>                 Idle time between acquisitions (default 0).\r\n");
+    printf("  -c <file>               Replay a NMEA capture (epochs separated by empty lines).\r\n");
+    printf("  -t <ms>                 Time to first fix (default 25000).\r\n");
+    printf("  -j <mm>                 Altitude jitter amplitude (default 0).\r\n");
+    printf("  -o <start_ms>,<ms>      Signal outage window.\r\n");
+    printf("  -N <ppm>                Byte corruption probability.\r\n");
+    printf("  -D <permille>           Epoch dropout probability.\r\n");
+    printf("  -R <ms>                 Receiver reset time.\r\n");
+    printf("  -s <seed>               Impairments seed (default 1).\r\n");
+    printf("  -g <sats>,<hdop>        Position quality gates (HDOP in tenths, default disabled).\r\n");
+#ifdef NEOM8X_DRIVER_SENTENCE_VIEW
+    printf("  -v <GSV,VTG,...>        Print the fields of the subscribed NMEA sentences.\r\n");
+#endif
+#ifdef NEOM8X_DRIVER_UBX_MGA
+    printf("  -A                      Inject coarse time and position before the first acquisition.\r\n");
+    printf("  -a <file>               Inject UBX-MGA aiding data before the first acquisition.\r\n");
+#endif
+#ifdef NEOM8X_DRIVER_UBX_SOS
+    printf("  -H                      Power-on with a navigation backup saved on shutdown (hot start).\r\n");
+    printf("  -S                      Save navigation data on shutdown after the last acquisition.\r\n");
+#endif
+#ifdef NEOM8X_DRIVER_POWER_SAVE
+    printf("  -P <cyclic|onoff>       Power save mode during acquisitions (default continuous).\r\n");
+    printf("  -u <ms>                 Power save update period (default measurement period).\r\n");
+    printf("  -Z                      Put the receiver in backup mode between acquisitions.\r\n");
+#endif
+}
+
+/*** NEOM8X EMULATOR MAIN main function ***/
+
+/*******************************************************************/
+int main(int argc, char* argv[]) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    NEOM8X_EMULATOR_configuration_t emulator_configuration;
+    NEOM8X_EMULATOR_statistics_t emulator_statistics;
+    NEOM8X_statistics_t driver_statistics;
+    uint32_t acquisition_idx = 0;
+    uint32_t uart_baud_rate = 0;
+#ifdef NEOM8X_DRIVER_SENTENCE_VIEW
+    uint32_t sentence_view_mask = 0;
+#endif
+#ifdef NEOM8X_DRIVER_UBX_SOS
+    NEOM8X_backup_restore_status_t restore_status = NEOM8X_BACKUP_RESTORE_STATUS_UNKNOWN;
+#endif
+    int option = 0;
+    // Default scenario.
+    NEOM8X_EMULATOR_get_default_configuration(&emulator_configuration);
+    memset(&neom8x_emulator_main_ctx, 0, sizeof(neom8x_emulator_main_ctx));
+    neom8x_emulator_main_ctx.gps_data = (NEOM8X_GPS_DATA_TIME | NEOM8X_GPS_DATA_POSITION);
+    neom8x_emulator_main_ctx.mode = NEOM8X_ACQUISITION_MODE_NMEA;
+    neom8x_emulator_main_ctx.uart_baud_rate = emulator_configuration.uart_baud_rate;
+    neom8x_emulator_main_ctx.acquisition_count = 1;
+    neom8x_emulator_main_ctx.timeout_ms = NEOM8X_EMULATOR_MAIN_TIMEOUT_MS_DEFAULT;
+    neom8x_emulator_main_ctx.latency_ms = NEOM8X_EMULATOR_MAIN_LATENCY_MS_DEFAULT;
+    // Parse arguments.
+    while ((option = getopt(argc, argv, "d:m:p:b:B:n:T:l:i:c:t:j:o:N:D:R:s:g:v:Aa:HSP:u:Zh")) != -1) {
+        switch (option) {
+        case 'd':
+            if (strcmp(optarg, "time") == 0) neom8x_emulator_main_ctx.gps_data = NEOM8X_GPS_DATA_TIME;
+            if (strcmp(optarg, "position") == 0) neom8x_emulator_main_ctx.gps_data = NEOM8X_GPS_DATA_POSITION;
+            break;
+        case 'm':
+            if (strcmp(optarg, "rmc") == 0) neom8x_emulator_main_ctx.mode = NEOM8X_ACQUISITION_MODE_NMEA_RMC;
+#ifdef NEOM8X_DRIVER_UBX_NAV_PVT
+            if (strcmp(optarg, "pvt") == 0) neom8x_emulator_main_ctx.mode = NEOM8X_ACQUISITION_MODE_UBX_NAV_PVT;
+#endif
+            break;
+        case 'p':
+            neom8x_emulator_main_ctx.measurement_period_ms = (uint16_t) strtoul(optarg, NULL, 10);
+            break;
+        case 'b':
+            neom8x_emulator_main_ctx.uart_baud_rate = (uint32_t) strtoul(optarg, NULL, 10);
+            break;
+        case 'B':
+            emulator_configuration.rx_block_size_bytes = (uint32_t) strtoul(optarg, NULL, 10);
+            break;
+        case 'n':
+            neom8x_emulator_main_ctx.acquisition_count = (uint32_t) strtoul(optarg, NULL, 10);
+            break;
+        case 'T':
+            neom8x_emulator_main_ctx.timeout_ms = (uint32_t) strtoul(optarg, NULL, 10);
+            break;
+        case 'l':
+            neom8x_emulator_main_ctx.latency_ms = (uint32_t) strtoul(optarg, NULL, 10);
+            if (neom8x_emulator_main_ctx.latency_ms == 0) neom8x_emulator_main_ctx.latency_ms = 1;
+            break;
+        case 'i':
+            neom8x_emulator_main_ctx.idle_ms = (uint32_t) strtoul(optarg, NULL, 10);
+            break;
+        case 'c':
+            emulator_configuration.capture_path = optarg;
+            break;
+        case 't':
+            emulator_configuration.time_to_first_fix_ms = (uint32_t) strtoul(optarg, NULL, 10);
+            break;
+        case 'j':
+            emulator_configuration.altitude_jitter_mm = (uint32_t) strtoul(optarg, NULL, 10);
+            break;
+        case 'o':
+            if (sscanf(optarg, "%u,%u", &emulator_configuration.outage_start_ms, &emulator_configuration.outage_duration_ms) != 2) goto usage;
+            break;
+        case 'N':
+            emulator_configuration.noise_ppm = (uint32_t) strtoul(optarg, NULL, 10);
+            break;
+        case 'D':
+            emulator_configuration.dropout_permille = (uint32_t) strtoul(optarg, NULL, 10);
+            break;
+        case 'R':
+            neom8x_emulator_main_ctx.reset_ms = (uint32_t) strtoul(optarg, NULL, 10);
+            break;
+        case 's':
+            emulator_configuration.seed = (uint32_t) strtoul(optarg, NULL, 10);
+            break;
+        case 'g':
+            if (sscanf(optarg, "%hhu,%hhu", &neom8x_emulator_main_ctx.satellites_min, &neom8x_emulator_main_ctx.hdop_max) != 2) goto usage;
+            break;
+#ifdef NEOM8X_DRIVER_SENTENCE_VIEW
+        case 'v':
+            sentence_view_mask = _NEOM8X_EMULATOR_MAIN_parse_nmea_message_mask(optarg);
+            break;
+#endif
+#ifdef NEOM8X_DRIVER_UBX_MGA
+        case 'A':
+            neom8x_emulator_main_ctx.coarse_aiding_flag = 1;
+            break;
+        case 'a':
+            neom8x_emulator_main_ctx.aiding_path = optarg;
+            break;
+#endif
+#ifdef NEOM8X_DRIVER_UBX_SOS
+        case 'H':
+            emulator_configuration.backup_flag = 1;
+            break;
+        case 'S':
+            neom8x_emulator_main_ctx.shutdown_flag = 1;
+            break;
+#endif
+#ifdef NEOM8X_DRIVER_POWER_SAVE
+        case 'P':
+            if (strcmp(optarg, "cyclic") == 0) neom8x_emulator_main_ctx.power_mode = NEOM8X_POWER_MODE_CYCLIC_TRACKING;
+            if (strcmp(optarg, "onoff") == 0) neom8x_emulator_main_ctx.power_mode = NEOM8X_POWER_MODE_ON_OFF;
+            break;
+        case 'u':
+            neom8x_emulator_main_ctx.power_save_period_ms = (uint32_t) strtoul(optarg, NULL, 10);
+            break;
+        case 'Z':
+            neom8x_emulator_main_ctx.sleep_on_stop = 1;
+            break;
+#endif
+        default:
+            goto usage;
+        }
+    }
+    // Power-on receiver and driver.
+    if (NEOM8X_EMULATOR_init(&emulator_configuration) != 0) {
+        fprintf(stderr, "Unable to load capture %s\r\n", emulator_configuration.capture_path);
+        return 1;
+    }
+    status = NEOM8X_init();
+    if (status != NEOM8X_SUCCESS) goto errors;
+#ifdef NEOM8X_DRIVER_SENTENCE_VIEW
+    status = NEOM8X_set_sentence_subscription(sentence_view_mask, &_NEOM8X_EMULATOR_MAIN_sentence_callback);
+    if (status != NEOM8X_SUCCESS) goto errors;
+#endif
+    if (neom8x_emulator_main_ctx.uart_baud_rate != emulator_configuration.uart_baud_rate) {
+        status = NEOM8X_set_baud_rate(neom8x_emulator_main_ctx.uart_baud_rate);
+        printf("[%8.3f] baud rate %u status=%d\r\n", (double) NEOM8X_EMULATOR_get_time_ms() / 1000.0, neom8x_emulator_main_ctx.uart_baud_rate, (int) status);
+    }
+#ifdef NEOM8X_DRIVER_UBX_MGA
+    status = _NEOM8X_EMULATOR_MAIN_inject_aiding(&emulator_configuration);
+    if (status != NEOM8X_SUCCESS) goto errors;
+#endif
+    // Run acquisitions.
+    for (acquisition_idx = 0; acquisition_idx < neom8x_emulator_main_ctx.acquisition_count; acquisition_idx++) {
+        status = _NEOM8X_EMULATOR_MAIN_acquire(acquisition_idx);
+        if (status != NEOM8X_SUCCESS) goto errors;
+        NEOM8X_EMULATOR_run(neom8x_emulator_main_ctx.idle_ms);
+    }
+    // Baud rate may have fallen back to default during the acquisitions.
+    status = NEOM8X_get_baud_rate(&uart_baud_rate);
+    if (status != NEOM8X_SUCCESS) goto errors;
+    printf("[%8.3f] link baud rate=%u\r\n", (double) NEOM8X_EMULATOR_get_time_ms() / 1000.0, uart_baud_rate);
+#ifdef NEOM8X_DRIVER_UBX_SOS
+    // Restore status is received during the first acquisition.
+    status = NEOM8X_get_backup_restore_status(&restore_status);
+    if (status != NEOM8X_SUCCESS) goto errors;
+    printf("[%8.3f] backup restore status=%u\r\n", (double) NEOM8X_EMULATOR_get_time_ms() / 1000.0, (unsigned int) restore_status);
+#endif
+#ifdef NEOM8X_DRIVER_UBX_SOS
+    if (neom8x_emulator_main_ctx.shutdown_flag != 0) {
+        status = NEOM8X_shutdown();
+        printf("[%8.3f] shutdown status=%d\r\n", (double) NEOM8X_EMULATOR_get_time_ms() / 1000.0, (int) status);
+        if (status != NEOM8X_SUCCESS) goto errors;
+    }
+#endif
+    // Print counters.
+    NEOM8X_get_statistics(&driver_statistics);
+    NEOM8X_EMULATOR_get_statistics(&emulator_statistics);
+    printf("Driver   : %u bytes, %u frames, %u checksum errors, %u field size errors, %u invalid data, %u buffer overflows, %u frames dropped\r\n",
+        driver_statistics.rx_byte_count, driver_statistics.frame_count, driver_statistics.checksum_error_count, driver_statistics.field_size_error_count,
+        driver_statistics.data_validity_error_count, driver_statistics.buffer_overflow_count, driver_statistics.frame_dropped_count);
+    printf("Emulator : %u bytes sent (%u lost, %u corrupted, %u while idle), %u epochs (%u dropped), %u commands (%u ignored), %u aiding messages (%u rejected), %u backups, %u ms in power save, %u ms in backup mode\r\n",
+        emulator_statistics.tx_byte_count, emulator_statistics.tx_byte_lost_count, emulator_statistics.corrupted_byte_count, emulator_statistics.idle_byte_count,
+        emulator_statistics.epoch_count, emulator_statistics.dropped_epoch_count, emulator_statistics.command_count, emulator_statistics.ignored_command_count,
+        emulator_statistics.aiding_count, emulator_statistics.rejected_aiding_count, emulator_statistics.backup_count,
+        emulator_statistics.power_save_time_ms, emulator_statistics.backup_time_ms);
+    NEOM8X_EMULATOR_de_init();
+    return 0;
+errors:
+    fprintf(stderr, "Driver error 0x%x\r\n", (unsigned int) status);
+    NEOM8X_EMULATOR_de_init();
+    return 1;
+usage:
+    _NEOM8X_EMULATOR_MAIN_print_usage(argv[0]);
+    return 1;
+}
@@ -0,0 +1,26 @@
+/*
+ * error.h
+ *
+ *  Created on: 16 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __ERROR_H__
+#define __ERROR_H__
+
+#include "types.h"
+
+/*** ERROR host stand-in (subset of embedded-utils) ***/
+
+#define ERROR_BASE_STEP     0x0100
+
+/*******************************************************************/
+#define ERROR_check_exit(status, success, base) { if ((status) != (success)) { status = (base) + (status); goto errors; } }
+
+/*******************************************************************/
+#define ERROR_check_stack(status, success, base) { if ((status) != (success)) { UNUSED(base); } }
+
+/*******************************************************************/
+#define ERROR_check_stack_exit(status, success, base, code) { if ((status) != (success)) { UNUSED(base); status = (code); goto errors; } }
+
+#endif /* __ERROR_H__ */
@@ -0,0 +1,17 @@
+/*
+ * maths.h
+ *
+ *  Created on: 16 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __MATHS_H__
+#define __MATHS_H__
+
+#include "types.h"
+
+/*** MATH host stand-in (subset of embedded-utils) ***/
+
+#define MATH_U32_MAX    0xFFFFFFFF
+
+#endif /* __MATHS_H__ */
@@ -0,0 +1,31 @@
+/*
+ * strings.h
+ *
+ *  Created on: 16 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __STRINGS_H__
+#define __STRINGS_H__
+
+#include "error.h"
+#include "types.h"
+
+/*** STRING host stand-in (subset of embedded-utils) ***/
+
+#define STRING_CHAR_NULL    '\0'
+#define STRING_CHAR_CR      '\r'
+#define STRING_CHAR_LF      '\n'
+#define STRING_CHAR_DOT     '.'
+#define STRING_CHAR_MINUS   '-'
+
+/*!******************************************************************
+ * \enum STRING_status_t
+ * \brief STRING functions return codes.
+ *******************************************************************/
+typedef enum {
+    STRING_SUCCESS = 0,
+    STRING_ERROR_BASE_LAST = ERROR_BASE_STEP
+} STRING_status_t;
+
+#endif /* __STRINGS_H__ */
@@ -0,0 +1,20 @@
+/*
+ * types.h
+ *
+ *  Created on: 16 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __TYPES_H__
+#define __TYPES_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*** TYPES host stand-in ***/
+
+typedef char char_t;
+
+#define UNUSED(x) ((void) (x))
+
+#endif /* __TYPES_H__ */
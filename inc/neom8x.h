@@ -30,9 +30,20 @@ typedef enum {
     NEOM8X_SUCCESS = 0,
     NEOM8X_ERROR_NULL_PARAMETER,
     NEOM8X_ERROR_ACQUISITION_DATA,
+    NEOM8X_ERROR_ACQUISITION_MODE,
     NEOM8X_ERROR_ACQUISITION_RUNNING,
+    NEOM8X_ERROR_MEASUREMENT_PERIOD,
+    NEOM8X_ERROR_BAUD_RATE,
+    NEOM8X_ERROR_BAUD_RATE_FALLBACK,
     NEOM8X_ERROR_TIMEPULSE_FREQUENCY,
     NEOM8X_ERROR_TIMEPULSE_DUTY_CYCLE,
+    NEOM8X_ERROR_UBX_ACK_TIMEOUT,
+    NEOM8X_ERROR_UBX_NAK,
+    NEOM8X_ERROR_SENTENCE_FIELD_INDEX,
+    NEOM8X_ERROR_POWER_MODE,
+    NEOM8X_ERROR_POWER_SAVE_PERIOD,
+    NEOM8X_ERROR_FIX_INDICATOR,
+    NEOM8X_ERROR_STABILITY_THRESHOLD,
     // Low level drivers errors.
     NEOM8X_ERROR_HW_FUNCTION_NOT_IMPLEMENTED,
     NEOM8X_ERROR_BASE_GPIO = ERROR_BASE_STEP,
@@ -60,19 +71,89 @@ typedef enum {
 
 /*!******************************************************************
  * \enum NEOM8X_data_t
- * \brief NEOM8X data list.
+ * \brief NEOM8X data list (bit field, several data can be acquired in the same session).
  *******************************************************************/
 typedef enum {
     NEOM8X_GPS_DATA_NONE = 0,
 #ifdef NEOM8X_DRIVER_GPS_DATA_TIME
-    NEOM8X_GPS_DATA_TIME,
+    NEOM8X_GPS_DATA_TIME = (0b1 << 0),
 #endif
 #ifdef NEOM8X_DRIVER_GPS_DATA_POSITION
-    NEOM8X_GPS_DATA_POSITION,
+    NEOM8X_GPS_DATA_POSITION = (0b1 << 1),
 #endif
-    NEOM8X_GPS_DATA_LAST
+    NEOM8X_GPS_DATA_LAST = (0b1 << 2)
 } NEOM8X_gps_data_t;
 
+/*!******************************************************************
+ * \enum NEOM8X_acquisition_mode_t
+ * \brief NEOM8X acquisition modes (RMC mode does not provide altitude).
+ *******************************************************************/
+typedef enum {
+    NEOM8X_ACQUISITION_MODE_NMEA = 0,
+    NEOM8X_ACQUISITION_MODE_NMEA_RMC,
+#ifdef NEOM8X_DRIVER_UBX_NAV_PVT
+    NEOM8X_ACQUISITION_MODE_UBX_NAV_PVT,
+#endif
+    NEOM8X_ACQUISITION_MODE_LAST
+} NEOM8X_acquisition_mode_t;
+
+#ifdef NEOM8X_DRIVER_GPS_DATA_POSITION
+/*!******************************************************************
+ * \enum NEOM8X_fix_indicator_t
+ * \brief NEOM8X position fix types sorted by increasing quality (manual input and simulator positions are below dead reckoning).
+ *******************************************************************/
+typedef enum {
+    NEOM8X_FIX_INDICATOR_NONE = 0,
+    NEOM8X_FIX_INDICATOR_SIMULATOR,
+    NEOM8X_FIX_INDICATOR_MANUAL,
+    NEOM8X_FIX_INDICATOR_DEAD_RECKONING,
+    NEOM8X_FIX_INDICATOR_AUTONOMOUS,
+    NEOM8X_FIX_INDICATOR_DIFFERENTIAL,
+    NEOM8X_FIX_INDICATOR_RTK_FLOAT,
+    NEOM8X_FIX_INDICATOR_RTK_FIXED,
+    NEOM8X_FIX_INDICATOR_LAST
+} NEOM8X_fix_indicator_t;
+#endif
+
+#ifdef NEOM8X_DRIVER_POWER_SAVE
+/*!******************************************************************
+ * \enum NEOM8X_power_mode_t
+ * \brief NEOM8X receiver power modes (power save modes keep tracking at reduced average current).
+ *******************************************************************/
+typedef enum {
+    NEOM8X_POWER_MODE_CONTINUOUS = 0,
+    NEOM8X_POWER_MODE_CYCLIC_TRACKING,
+    NEOM8X_POWER_MODE_ON_OFF,
+    NEOM8X_POWER_MODE_LAST
+} NEOM8X_power_mode_t;
+#endif
+
+/*!******************************************************************
+ * \enum NEOM8X_nmea_message_index_t
+ * \brief NEOM8X NMEA messages list (used as bit index in NMEA messages masks).
+ *******************************************************************/
+typedef enum {
+    NEOM8X_NMEA_MESSAGE_INDEX_DTM = 0,
+    NEOM8X_NMEA_MESSAGE_INDEX_GBQ,
+    NEOM8X_NMEA_MESSAGE_INDEX_GBS,
+    NEOM8X_NMEA_MESSAGE_INDEX_GGA,
+    NEOM8X_NMEA_MESSAGE_INDEX_GLL,
+    NEOM8X_NMEA_MESSAGE_INDEX_GLQ,
+    NEOM8X_NMEA_MESSAGE_INDEX_GNQ,
+    NEOM8X_NMEA_MESSAGE_INDEX_GNS,
+    NEOM8X_NMEA_MESSAGE_INDEX_GPQ,
+    NEOM8X_NMEA_MESSAGE_INDEX_GRS,
+    NEOM8X_NMEA_MESSAGE_INDEX_GSA,
+    NEOM8X_NMEA_MESSAGE_INDEX_GST,
+    NEOM8X_NMEA_MESSAGE_INDEX_GSV,
+    NEOM8X_NMEA_MESSAGE_INDEX_RMC,
+    NEOM8X_NMEA_MESSAGE_INDEX_TXT,
+    NEOM8X_NMEA_MESSAGE_INDEX_VLW,
+    NEOM8X_NMEA_MESSAGE_INDEX_VTG,
+    NEOM8X_NMEA_MESSAGE_INDEX_ZDA,
+    NEOM8X_NMEA_MESSAGE_INDEX_LAST
+} NEOM8X_nmea_message_index_t;
+
 /*!******************************************************************
  * \fn NEOM8X_process_cb_t
  * \brief NEOM8X driver process callback.
@@ -81,20 +162,42 @@ typedef void (*NEOM8X_process_cb_t)(void);
 
 /*!******************************************************************
  * \fn NEOM8X_completion_cb_t
- * \brief NEOM8X acquisition completion callback.
+ * \brief NEOM8X acquisition completion callback, called for each acquired data type.
+ * A failure status is reported for each requested data type when the receiver configuration fails, the acquisition being released.
  *******************************************************************/
-typedef void (*NEOM8X_completion_cb_t)(NEOM8X_acquisition_status_t acquisition_status);
+typedef void (*NEOM8X_completion_cb_t)(NEOM8X_gps_data_t gps_data, NEOM8X_acquisition_status_t acquisition_status);
 
 /*!******************************************************************
  * \struct NEOM8X_acquisition_t
- * \brief NEOM8X acquisition parameters.
+ * \brief NEOM8X acquisition parameters. The gps_data field is a bit field of NEOM8X_gps_data_t and a null measurement period selects the module default rate (1 Hz).
+ * The position is stable when the last altitude_stability_threshold fixes (16 max) fit in the horizontal and vertical spreads.
+ * Fixes below the quality gates are ignored (null values are disabled, HDOP is expressed in tenths, satellites and HDOP gates are not applied in RMC mode).
+ * When a timeout is given, the position acquisition is reported as failed as soon as the required fixes can't be received before it anymore,
+ * including when the satellites or HDOP trend of persistently rejected fixes can't reach the gates in time.
  *******************************************************************/
 typedef struct {
-    NEOM8X_gps_data_t gps_data;
+    uint8_t gps_data;
+    NEOM8X_acquisition_mode_t mode;
     NEOM8X_process_cb_t process_callback;
     NEOM8X_completion_cb_t completion_callback;
+    uint16_t measurement_period_ms;
 #if ((defined NEOM8X_DRIVER_GPS_DATA_POSITION) && (NEOM8X_DRIVER_ALTITUDE_STABILITY_FILTER_MODE == 2))
     uint8_t altitude_stability_threshold;
+    uint8_t horizontal_stability_threshold_m;
+    uint8_t vertical_stability_threshold_m;
+#endif
+#ifdef NEOM8X_DRIVER_GPS_DATA_POSITION
+    NEOM8X_fix_indicator_t fix_indicator_min;
+    uint8_t satellites_min;
+    uint8_t hdop_max;
+    uint32_t timeout_ms;
+#endif
+#ifdef NEOM8X_DRIVER_POWER_SAVE
+    // Power mode kept between acquisitions (a null period selects the measurement period).
+    NEOM8X_power_mode_t power_mode;
+    uint32_t power_save_period_ms;
+    // Put the module in backup mode until UART activity when the acquisition is stopped.
+    uint8_t sleep_on_stop;
 #endif
 } NEOM8X_acquisition_t;
 
@@ -132,6 +235,111 @@ typedef struct {
     uint32_t altitude;
 } NEOM8X_position_t;
 
+#ifdef NEOM8X_DRIVER_GPS_DATA_POSITION
+/*!******************************************************************
+ * \struct NEOM8X_fix_quality_t
+ * \brief GPS fix quality indicators. Note: HDOP is expressed in tenths (saturated to 255), satellites and HDOP are not available in RMC mode.
+ *******************************************************************/
+typedef struct {
+    NEOM8X_fix_indicator_t fix_indicator;
+    uint8_t number_of_satellites;
+    uint8_t hdop;
+} NEOM8X_fix_quality_t;
+
+/*!******************************************************************
+ * \struct NEOM8X_position_e7_t
+ * \brief GPS position in fixed-point format (WGS84 coordinates in 1e-7 degrees with north and east positive, altitude above mean sea level in mm).
+ *******************************************************************/
+typedef struct {
+    int32_t latitude_e7;
+    int32_t longitude_e7;
+    int32_t altitude_mm;
+} NEOM8X_position_e7_t;
+
+/*!******************************************************************
+ * \struct NEOM8X_position_extended_t
+ * \brief GPS position data with the quality indicators of the fix.
+ *******************************************************************/
+typedef struct {
+    NEOM8X_position_t position;
+    NEOM8X_fix_quality_t fix_quality;
+} NEOM8X_position_extended_t;
+#endif
+
+/*!******************************************************************
+ * \struct NEOM8X_statistics_t
+ * \brief NEOM8X driver reception and decoding counters.
+ *******************************************************************/
+typedef struct {
+    // Reception interrupt.
+    uint32_t rx_byte_count;
+    uint32_t frame_count;
+    uint32_t buffer_overflow_count;
+    uint32_t frame_dropped_count;
+    uint32_t checksum_error_count;
+    // Decoding.
+    uint32_t field_size_error_count;
+    uint32_t data_validity_error_count;
+} NEOM8X_statistics_t;
+
+#ifdef NEOM8X_DRIVER_SENTENCE_VIEW
+/*!******************************************************************
+ * \struct NEOM8X_sentence_view_t
+ * \brief Read-only view of a validated NMEA sentence, pointing directly into the driver reception buffer.
+ * Field i (the address being field 0) starts at sentence[field_offset[i]] and is not null-terminated.
+ *******************************************************************/
+typedef struct {
+    NEOM8X_nmea_message_index_t nmea_message_index;
+    const char_t* sentence;
+    uint8_t number_of_fields;
+    const uint8_t* field_offset;
+} NEOM8X_sentence_view_t;
+
+/*!******************************************************************
+ * \fn NEOM8X_sentence_cb_t
+ * \brief NEOM8X sentence view callback (the view and its buffer are only valid until the callback returns).
+ *******************************************************************/
+typedef void (*NEOM8X_sentence_cb_t)(const NEOM8X_sentence_view_t* sentence_view);
+#endif
+
+#ifdef NEOM8X_DRIVER_UBX_MGA
+/*!******************************************************************
+ * \struct NEOM8X_aiding_position_t
+ * \brief Coarse position used as aiding data (WGS84 coordinates in 1e-7 degrees, altitude above ellipsoid and accuracy in cm).
+ *******************************************************************/
+typedef struct {
+    int32_t latitude_e7;
+    int32_t longitude_e7;
+    int32_t altitude_cm;
+    uint32_t accuracy_cm;
+} NEOM8X_aiding_position_t;
+
+/*!******************************************************************
+ * \struct NEOM8X_aiding_result_t
+ * \brief Aiding data injection report.
+ *******************************************************************/
+typedef struct {
+    uint32_t processed_size_bytes;
+    uint16_t accepted_message_count;
+    uint16_t rejected_message_count;
+    uint16_t skipped_message_count;
+} NEOM8X_aiding_result_t;
+#endif
+
+#ifdef NEOM8X_DRIVER_UBX_SOS
+/*!******************************************************************
+ * \enum NEOM8X_backup_restore_status_t
+ * \brief Restore status of the navigation backup created on shutdown.
+ *******************************************************************/
+typedef enum {
+    NEOM8X_BACKUP_RESTORE_STATUS_UNKNOWN = 0,
+    NEOM8X_BACKUP_RESTORE_STATUS_FAILED,
+    NEOM8X_BACKUP_RESTORE_STATUS_RESTORED,
+    NEOM8X_BACKUP_RESTORE_STATUS_NO_BACKUP,
+    NEOM8X_BACKUP_RESTORE_STATUS_LAST
+} NEOM8X_backup_restore_status_t;
+#endif
+
 /*!******************************************************************
  * \struct NEOM8X_timepulse_configuration_t
  * \brief Timepulse signal parameters.
@@ -173,7 +381,8 @@ NEOM8X_status_t NEOM8X_start_acquisition(NEOM8X_acquisition_t* acquisition);
 
 /*!******************************************************************
  * \fn NEOM8X_status_t NEOM8X_stop_acquisition(void)
- * \brief Stop GPS acquisition.
+ * \brief Stop GPS acquisition and disable the module output until the next acquisition.
+ * Reception is stopped first, the output commands are not acknowledged and are applied again by the next acquisition if needed.
  * \param[in]   none
  * \param[out]  none
  * \retval      Function execution status.
@@ -209,6 +418,146 @@ NEOM8X_status_t NEOM8X_get_time(NEOM8X_time_t* gps_time);
  * \retval      Function execution status.
  *******************************************************************/
 NEOM8X_status_t NEOM8X_get_position(NEOM8X_position_t* gps_position);
+
+/*!******************************************************************
+ * \fn NEOM8X_status_t NEOM8X_get_position_extended(NEOM8X_position_extended_t* gps_position_extended)
+ * \brief Read GPS position data and fix quality of last acquisition.
+ * \param[in]   none
+ * \param[out]  gps_position_extended: Pointer to the last GPS position data and fix quality.
+ * \retval      Function execution status.
+ *******************************************************************/
+NEOM8X_status_t NEOM8X_get_position_extended(NEOM8X_position_extended_t* gps_position_extended);
+
+/*!******************************************************************
+ * \fn NEOM8X_status_t NEOM8X_get_position_e7(NEOM8X_position_e7_t* gps_position_e7)
+ * \brief Read GPS position of last acquisition in fixed-point format (computed with integer arithmetic during decoding, altitude is 0 in RMC mode).
+ * \param[in]   none
+ * \param[out]  gps_position_e7: Pointer to the last GPS position in fixed-point format.
+ * \retval      Function execution status.
+ *******************************************************************/
+NEOM8X_status_t NEOM8X_get_position_e7(NEOM8X_position_e7_t* gps_position_e7);
+#endif
+
+/*!******************************************************************
+ * \fn NEOM8X_status_t NEOM8X_get_statistics(NEOM8X_statistics_t* statistics)
+ * \brief Read driver reception and decoding counters.
+ * \param[in]   none
+ * \param[out]  statistics: Pointer to the current reception counters.
+ * \retval      Function execution status.
+ *******************************************************************/
+NEOM8X_status_t NEOM8X_get_statistics(NEOM8X_statistics_t* statistics);
+
+/*!******************************************************************
+ * \fn NEOM8X_status_t NEOM8X_reset_statistics(void)
+ * \brief Reset driver reception and decoding counters.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+NEOM8X_status_t NEOM8X_reset_statistics(void);
+
+#ifdef NEOM8X_DRIVER_SENTENCE_VIEW
+/*!******************************************************************
+ * \fn NEOM8X_status_t NEOM8X_set_sentence_subscription(uint32_t nmea_message_mask, NEOM8X_sentence_cb_t sentence_callback)
+ * \brief Subscribe to raw NMEA sentences, which are enabled on the module during the next acquisitions and given to the callback from the process function.
+ * \param[in]   nmea_message_mask: Bit field of NEOM8X_nmea_message_index_t (0 to cancel the subscription).
+ * \param[in]   sentence_callback: Function called for each validated sentence of the subscribed messages.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+NEOM8X_status_t NEOM8X_set_sentence_subscription(uint32_t nmea_message_mask, NEOM8X_sentence_cb_t sentence_callback);
+#endif
+
+#ifdef NEOM8X_DRIVER_SENTENCE_VIEW
+/*!******************************************************************
+ * \fn NEOM8X_status_t NEOM8X_get_sentence_field(const NEOM8X_sentence_view_t* sentence_view, uint8_t field_index, const char_t** field, uint8_t* field_size_bytes)
+ * \brief Get a field of a sentence view.
+ * \param[in]   sentence_view: Pointer to the sentence view given to the callback.
+ * \param[in]   field_index: Index of the field to read (0 is the address).
+ * \param[out]  field: Pointer to the first character of the field.
+ * \param[out]  field_size_bytes: Pointer to the field size in bytes (0 for an empty field).
+ * \retval      Function execution status.
+ *******************************************************************/
+NEOM8X_status_t NEOM8X_get_sentence_field(const NEOM8X_sentence_view_t* sentence_view, uint8_t field_index, const char_t** field, uint8_t* field_size_bytes);
+#endif
+
+/*!******************************************************************
+ * \fn NEOM8X_status_t NEOM8X_set_baud_rate(uint32_t baud_rate)
+ * \brief Request a new GPS module UART baud rate, applied by the configuration pipeline of the next acquisition.
+ * If the link can not be confirmed at the new baud rate, the driver falls back to 9600 bauds, aborts the acquisition and the process function returns NEOM8X_ERROR_BAUD_RATE_FALLBACK.
+ * \param[in]   baud_rate: New baud rate in bits per second.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+NEOM8X_status_t NEOM8X_set_baud_rate(uint32_t baud_rate);
+
+/*!******************************************************************
+ * \fn NEOM8X_status_t NEOM8X_get_baud_rate(uint32_t* baud_rate)
+ * \brief Get the GPS module UART baud rate currently used by the driver.
+ * \param[in]   none
+ * \param[out]  baud_rate: Pointer to the current baud rate in bits per second.
+ * \retval      Function execution status.
+ *******************************************************************/
+NEOM8X_status_t NEOM8X_get_baud_rate(uint32_t* baud_rate);
+
+#ifdef NEOM8X_DRIVER_UBX_MGA
+/*!******************************************************************
+ * \fn NEOM8X_status_t NEOM8X_inject_aiding_time(NEOM8X_time_t* utc_time, uint16_t time_accuracy_seconds)
+ * \brief Send coarse UTC time to the GPS module (UBX-MGA-INI-TIME_UTC).
+ * \param[in]   utc_time: Pointer to the current UTC time.
+ * \param[in]   time_accuracy_seconds: Accuracy of the given time in seconds.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+NEOM8X_status_t NEOM8X_inject_aiding_time(NEOM8X_time_t* utc_time, uint16_t time_accuracy_seconds);
+#endif
+
+#ifdef NEOM8X_DRIVER_UBX_MGA
+/*!******************************************************************
+ * \fn NEOM8X_status_t NEOM8X_inject_aiding_position(NEOM8X_aiding_position_t* position)
+ * \brief Send coarse position to the GPS module (UBX-MGA-INI-POS_LLH).
+ * \param[in]   position: Pointer to the approximate position.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+NEOM8X_status_t NEOM8X_inject_aiding_position(NEOM8X_aiding_position_t* position);
+#endif
+
+#ifdef NEOM8X_DRIVER_UBX_MGA
+/*!******************************************************************
+ * \fn NEOM8X_status_t NEOM8X_inject_aiding_data(uint8_t* mga_data, uint32_t mga_data_size_bytes, NEOM8X_aiding_result_t* aiding_result)
+ * \brief Stream UBX-MGA messages (AssistNow data) to the GPS module, each message being sent once the previous one has been acknowledged.
+ * An incomplete trailing message is not processed, so that large files can be injected by successive chunks.
+ * \param[in]   mga_data: Buffer of complete UBX frames.
+ * \param[in]   mga_data_size_bytes: Size of the buffer in bytes.
+ * \param[out]  aiding_result: Pointer to the injection report.
+ * \retval      Function execution status.
+ *******************************************************************/
+NEOM8X_status_t NEOM8X_inject_aiding_data(uint8_t* mga_data, uint32_t mga_data_size_bytes, NEOM8X_aiding_result_t* aiding_result);
+#endif
+
+#ifdef NEOM8X_DRIVER_UBX_SOS
+/*!******************************************************************
+ * \fn NEOM8X_status_t NEOM8X_shutdown(void)
+ * \brief Stop GNSS and save the navigation data in the module flash (UBX-UPD-SOS), then turn backup voltage off when controlled by the driver.
+ * The module must be power cycled afterwards: the backup is restored on next boot to perform a hot start.
+ * The receiver configuration is applied again by the next acquisition, which also restarts the GNSS if the module has not been power cycled.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+NEOM8X_status_t NEOM8X_shutdown(void);
+#endif
+
+#ifdef NEOM8X_DRIVER_UBX_SOS
+/*!******************************************************************
+ * \fn NEOM8X_status_t NEOM8X_get_backup_restore_status(NEOM8X_backup_restore_status_t* restore_status)
+ * \brief Get the restore status of the navigation backup, sent by the module after boot or polled when an acquisition starts (unknown until then).
+ * \param[in]   none
+ * \param[out]  restore_status: Pointer to the backup restore status.
+ * \retval      Function execution status.
+ *******************************************************************/
+NEOM8X_status_t NEOM8X_get_backup_restore_status(NEOM8X_backup_restore_status_t* restore_status);
 #endif
 
 #ifdef NEOM8X_DRIVER_VBCKP_CONTROL
@@ -24,13 +24,31 @@
  *******************************************************************/
 typedef void (*NEOM8X_HW_rx_irq_cb_t)(uint8_t message_byte);
 
+#ifdef NEOM8X_DRIVER_RX_BLOCK
+/*!******************************************************************
+ * \fn NEOM8X_HW_rx_block_cb_t
+ * \brief Block reception callback (for example on UART idle line or DMA transfer complete interrupt).
+ *******************************************************************/
+typedef void (*NEOM8X_HW_rx_block_cb_t)(uint8_t* data, uint32_t data_size_bytes);
+#endif
+
+/*!******************************************************************
+ * \fn NEOM8X_HW_timer_irq_cb_t
+ * \brief Timer expiration interrupt callback.
+ *******************************************************************/
+typedef void (*NEOM8X_HW_timer_irq_cb_t)(void);
+
 /*!******************************************************************
  * \struct NEOM8X_HW_configuration_t
- * \brief NEOM8X hardware interface parameters.
+ * \brief NEOM8X hardware interface parameters. When the block interface is enabled, received data can be given either byte per byte or by blocks.
  *******************************************************************/
 typedef struct {
     uint32_t uart_baud_rate;
     NEOM8X_HW_rx_irq_cb_t rx_irq_callback;
+#ifdef NEOM8X_DRIVER_RX_BLOCK
+    NEOM8X_HW_rx_block_cb_t rx_block_callback;
+#endif
+    NEOM8X_HW_timer_irq_cb_t timer_irq_callback;
 } NEOM8X_HW_configuration_t;
 
 /*** NEOM8X HW functions ***/
@@ -90,6 +108,24 @@ NEOM8X_status_t NEOM8X_HW_stop_rx(void);
  *******************************************************************/
 NEOM8X_status_t NEOM8X_HW_delay_milliseconds(uint32_t delay_ms);
 
+/*!******************************************************************
+ * \fn NEOM8X_status_t NEOM8X_HW_start_timer(uint32_t duration_ms)
+ * \brief Start a single shot timer which calls the timer interrupt callback on expiration.
+ * \param[in]   duration_ms: Timer duration in ms.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+NEOM8X_status_t NEOM8X_HW_start_timer(uint32_t duration_ms);
+
+/*!******************************************************************
+ * \fn NEOM8X_status_t NEOM8X_HW_stop_timer(void)
+ * \brief Stop timer.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+NEOM8X_status_t NEOM8X_HW_stop_timer(void);
+
 #ifdef NEOM8X_DRIVER_VBCKP_CONTROL
 /*!******************************************************************
  * \fn NEOM8X_status_t NEOM8X_HW_set_backup_voltage(uint8_t state)
@@ -20,63 +20,277 @@
 
 /*** NEOM8X local macros ***/
 
-#define NEOM8X_UART_BAUD_RATE                   9600
+#define NEOM8X_UART_BAUD_RATE_DEFAULT           9600
+#define NEOM8X_UART_BAUD_RATE_MIN               4800
+#define NEOM8X_UART_BAUD_RATE_MAX               921600
+#define NEOM8X_UART_BAUD_RATE_SWITCH_DELAY_MS   100
 
 #define NEOM8X_UBX_MSG_OVERHEAD_SIZE_BYTES      8
+#define NEOM8X_UBX_HEADER_SIZE_BYTES            4
+#define NEOM8X_UBX_PAYLOAD_OFFSET               6
+
+#define NEOM8X_UBX_SYNC_CHAR_1                  0xB5
+#define NEOM8X_UBX_SYNC_CHAR_2                  0x62
 
 #define NEOM8X_UBX_CHECKSUM_OVERHEAD_SIZE_BYTES 4
 #define NEOM8X_UBX_CHECKSUM_OFFSET_BYTES        2
 
+#define NEOM8X_UBX_CLASS_ACK                    0x05
+#define NEOM8X_UBX_ID_ACK_NAK                   0x00
+#define NEOM8X_UBX_ID_ACK_ACK                   0x01
+#define NEOM8X_UBX_ACK_PAYLOAD_SIZE_BYTES       2
+
+#define NEOM8X_UBX_CLASS_NAV                    0x01
+#define NEOM8X_UBX_ID_NAV_PVT                   0x07
+#define NEOM8X_UBX_NAV_PVT_PAYLOAD_SIZE_BYTES   92
+#define NEOM8X_UBX_NAV_PVT_VALID_DATE_TIME      0x07
+#define NEOM8X_UBX_NAV_PVT_FLAGS_GNSS_FIX_OK    0x01
+#define NEOM8X_UBX_NAV_PVT_FLAGS_DIFF_SOLN      0x02
+#define NEOM8X_UBX_NAV_PVT_FLAGS_CARR_SOLN_MASK 0xC0
+#define NEOM8X_UBX_NAV_PVT_FLAGS_CARR_SOLN_FLOAT 0x40
+#define NEOM8X_UBX_NAV_PVT_FLAGS_CARR_SOLN_FIXED 0x80
+#define NEOM8X_UBX_NAV_PVT_FIX_TYPE_3D          3
+#define NEOM8X_UBX_NAV_PVT_FIX_TYPE_GNSS_DR     4
+
+#define NEOM8X_UBX_CLASS_NMEA                   0xF0
+
+#define NEOM8X_UBX_CLASS_MGA                    0x13
+#define NEOM8X_UBX_ID_MGA_INI                   0x40
+#define NEOM8X_UBX_ID_MGA_FLASH                 0x21
+#define NEOM8X_UBX_ID_MGA_ACK                   0x60
+#define NEOM8X_UBX_MGA_ACK_PAYLOAD_SIZE_BYTES   8
+#define NEOM8X_UBX_MGA_ACK_TYPE_ACCEPTED        0x01
+#define NEOM8X_UBX_MGA_ACK_PAYLOAD_START_OFFSET 4
+#define NEOM8X_UBX_MGA_PAYLOAD_START_SIZE_BYTES 4
+#define NEOM8X_UBX_MGA_INI_TIME_UTC_SIZE_BYTES  24
+#define NEOM8X_UBX_MGA_INI_POS_LLH_SIZE_BYTES   20
+#define NEOM8X_UBX_CFG_NAVX5_PAYLOAD_SIZE_BYTES 40
+
+#define NEOM8X_UBX_CLASS_UPD                    0x09
+#define NEOM8X_UBX_ID_UPD_SOS                   0x14
+#define NEOM8X_UBX_UPD_SOS_COMMAND_SIZE_BYTES   4
+#define NEOM8X_UBX_UPD_SOS_RESPONSE_SIZE_BYTES  8
+#define NEOM8X_UBX_UPD_SOS_CMD_CREATE_BACKUP    0x00
+#define NEOM8X_UBX_UPD_SOS_CMD_BACKUP_ACK       0x02
+#define NEOM8X_UBX_UPD_SOS_CMD_RESTORED         0x03
+#define NEOM8X_UBX_UPD_SOS_RESPONSE_OFFSET      4
+#define NEOM8X_UBX_UPD_SOS_ACK_TIMEOUT_MS       1000
+#define NEOM8X_UBX_CFG_RST_PAYLOAD_SIZE_BYTES   4
+#define NEOM8X_UBX_CFG_RST_MODE_GNSS_STOP       0x08
+#define NEOM8X_UBX_CFG_RST_MODE_GNSS_START      0x09
+
+#define NEOM8X_UBX_CFG_PM2_PAYLOAD_SIZE_BYTES   44
+#define NEOM8X_UBX_CFG_PM2_MODE_CYCLIC_TRACKING 0x02
+#define NEOM8X_UBX_CFG_PM2_SEARCH_PERIOD_MS     10000
+#define NEOM8X_UBX_CFG_RXM_PAYLOAD_SIZE_BYTES   2
+#define NEOM8X_UBX_RXM_PMREQ_PAYLOAD_SIZE_BYTES 16
+#define NEOM8X_POWER_SAVE_PERIOD_MIN_MS         1000
+#define NEOM8X_WAKE_UP_SEQUENCE_SIZE_BYTES      8
+
+#if ((defined NEOM8X_DRIVER_UBX_MGA) || (defined NEOM8X_DRIVER_UBX_SOS))
+#define NEOM8X_UBX_RX_PAYLOAD_SIZE_BYTES        8
+#else
+#define NEOM8X_UBX_RX_PAYLOAD_SIZE_BYTES        NEOM8X_UBX_ACK_PAYLOAD_SIZE_BYTES
+#endif
+
 #define NEOM8X_UBX_CFG_MSG_PAYLOAD_SIZE_BYTES   8
+#define NEOM8X_UBX_CFG_MSG_RATE_OFFSET          8
+#define NEOM8X_UBX_CFG_MSG_NUMBER_OF_PORTS      6
+
+#if ((defined NEOM8X_DRIVER_GPS_DATA_TIME) && (defined NEOM8X_DRIVER_GPS_DATA_POSITION))
+#define NEOM8X_GPS_DATA_SUPPORTED_MASK          (NEOM8X_GPS_DATA_TIME | NEOM8X_GPS_DATA_POSITION)
+#elif (defined NEOM8X_DRIVER_GPS_DATA_TIME)
+#define NEOM8X_GPS_DATA_SUPPORTED_MASK          NEOM8X_GPS_DATA_TIME
+#elif (defined NEOM8X_DRIVER_GPS_DATA_POSITION)
+#define NEOM8X_GPS_DATA_SUPPORTED_MASK          NEOM8X_GPS_DATA_POSITION
+#else
+#define NEOM8X_GPS_DATA_SUPPORTED_MASK          0
+#endif
+
+#define NEOM8X_UBX_CFG_RATE_PAYLOAD_SIZE_BYTES  6
+#define NEOM8X_MEASUREMENT_PERIOD_DEFAULT_MS    1000
+#define NEOM8X_MEASUREMENT_PERIOD_MIN_MS        50
+
+#define NEOM8X_UBX_CFG_PRT_PAYLOAD_SIZE_BYTES   20
+#define NEOM8X_UBX_CFG_PRT_BAUD_RATE_OFFSET     14
+#define NEOM8X_UBX_PROTOCOL_UBX                 0x01
+#define NEOM8X_UBX_PROTOCOL_NMEA                0x02
 #define NEOM8X_UBX_CFG_TP5_PAYLOAD_SIZE_BYTES   32
 
-#define NEOM8X_NMEA_RX_BUFFER_SIZE_BYTES        128
-#define NEOM8X_NMEA_RX_BUFFER_DEPTH             2
+#define NEOM8X_RX_BUFFER_SIZE_BYTES             NEOM8X_DRIVER_RX_BUFFER_SIZE_BYTES
+#define NEOM8X_RX_BUFFER_DEPTH                  NEOM8X_DRIVER_RX_BUFFER_DEPTH
+#define NEOM8X_RX_BUFFER_INDEX_MASK             (NEOM8X_RX_BUFFER_DEPTH - 1)
 
 #define NEOM8X_NMEA_CHAR_MESSAGE_START          '$'
 #define NEOM8X_NMEA_CHAR_CHECKSUM_START         '*'
 #define NEOM8X_NMEA_CHAR_SEPARATOR              ','
+#define NEOM8X_NMEA_CHAR_CR                     STRING_CHAR_CR
 #define NEOM8X_NMEA_CHAR_END                    STRING_CHAR_LF
+#define NEOM8X_NMEA_CHAR_MINUS                  '-'
+#define NEOM8X_NMEA_CHECKSUM_SIZE_BYTES         2
+
+#define NEOM8X_NMEA_ADDRESS_SIZE_BYTES          6
+#define NEOM8X_NMEA_MESSAGE_NAME_OFFSET         3
+#define NEOM8X_NMEA_MESSAGE_NAME_SIZE_BYTES     3
+
+#define NEOM8X_NMEA_FIELD_NUMBER_MAX            24
+
+#define NEOM8X_DECIMAL_DIGITS_MAX               8
+#define NEOM8X_HEXADECIMAL_DIGITS_MAX           8
+#define NEOM8X_SWAR_CHAR_0                      0x3030303030303030
+#define NEOM8X_SWAR_CHAR_9_OVERFLOW             0x4646464646464646
+#define NEOM8X_SWAR_LANE_MSB                    0x8080808080808080
+// SWAR decimal decoder is only built on request, since it is not faster than the loop on the short NMEA fields (see host bench).
+#ifndef NEOM8X_DECIMAL_DECODER_SWAR
+#define NEOM8X_DECIMAL_DECODER_SWAR             0
+#endif
 
 #define NEOM8X_NMEA_GGA_NORTH                   'N'
 #define NEOM8X_NMEA_GGA_SOUTH                   'S'
 #define NEOM8X_NMEA_GGA_EAST                    'E'
 #define NEOM8X_NMEA_GGA_WEST                    'W'
 #define NEOM8X_NMEA_GGA_METERS                  'M'
+#define NEOM8X_NMEA_GGA_QUALITY_NO_FIX          '0'
+#define NEOM8X_NMEA_GGA_QUALITY_AUTONOMOUS      '1'
+#define NEOM8X_NMEA_GGA_QUALITY_DIFFERENTIAL    '2'
+#define NEOM8X_NMEA_GGA_QUALITY_RTK_FIXED       '4'
+#define NEOM8X_NMEA_GGA_QUALITY_RTK_FLOAT       '5'
+#define NEOM8X_NMEA_GGA_QUALITY_DEAD_RECKONING  '6'
+#define NEOM8X_NMEA_GGA_QUALITY_MANUAL          '7'
+#define NEOM8X_NMEA_GGA_QUALITY_SIMULATOR       '8'
+#define NEOM8X_NMEA_RMC_STATUS_VALID            'A'
+// RMC date only gives the last two digits of the year: RMC dates are decoded within 2000-2099.
+#define NEOM8X_NMEA_RMC_CENTURY                 2000
+#define NEOM8X_NMEA_RMC_POS_MODE_AUTONOMOUS     'A'
+#define NEOM8X_NMEA_RMC_POS_MODE_DIFFERENTIAL   'D'
+#define NEOM8X_NMEA_RMC_POS_MODE_RTK_FIXED      'R'
+#define NEOM8X_NMEA_RMC_POS_MODE_RTK_FLOAT      'F'
+#define NEOM8X_NMEA_RMC_POS_MODE_DEAD_RECKONING 'E'
+#define NEOM8X_NMEA_RMC_POS_MODE_MANUAL         'M'
+#define NEOM8X_NMEA_RMC_POS_MODE_SIMULATOR      'S'
+
+#define NEOM8X_UBX_ACK_TIMEOUT_MS               250
+#define NEOM8X_UBX_COMMAND_RETRY_MAX            3
+#define NEOM8X_UBX_ACK_POLLING_PERIOD_MS        10
 
 #define NEOM8X_TIMEPULSE_FREQUENCY_HZ_MAX       10000000
 
+#if ((NEOM8X_RX_BUFFER_DEPTH < 2) || (NEOM8X_RX_BUFFER_DEPTH > 128) || ((NEOM8X_RX_BUFFER_DEPTH & NEOM8X_RX_BUFFER_INDEX_MASK) != 0))
+#error "NEOM8X_DRIVER_RX_BUFFER_DEPTH must be a power of 2 between 2 and 128"
+#endif
+#if ((NEOM8X_DECIMAL_DECODER_SWAR != 0) && (__SIZEOF_POINTER__ != 8))
+#error "SWAR decimal decoder requires a 64-bit target"
+#endif
+#if ((NEOM8X_RX_BUFFER_SIZE_BYTES < 16) || (NEOM8X_RX_BUFFER_SIZE_BYTES > 255))
+#error "NEOM8X_DRIVER_RX_BUFFER_SIZE_BYTES must be between 16 and 255"
+#endif
+#if ((defined NEOM8X_DRIVER_UBX_NAV_PVT) && (NEOM8X_RX_BUFFER_SIZE_BYTES < (NEOM8X_UBX_MSG_OVERHEAD_SIZE_BYTES + NEOM8X_UBX_NAV_PVT_PAYLOAD_SIZE_BYTES)))
+#error "NEOM8X_DRIVER_RX_BUFFER_SIZE_BYTES is too small to store UBX-NAV-PVT messages"
+#endif
+
 #if (NEOM8X_DRIVER_ALTITUDE_STABILITY_FILTER_MODE == 1)
 #define NEOM8X_ALTITUDE_STABILITY_THRESHOLD     NEOM8X_DRIVER_ALTITUDE_STABILITY_THRESHOLD
+// Default spreads keep the former behaviour (identical altitudes) with the widest horizontal spread of the dynamic mode.
+#ifdef NEOM8X_DRIVER_POSITION_STABILITY_HORIZONTAL_M
+#define NEOM8X_HORIZONTAL_STABILITY_THRESHOLD_M NEOM8X_DRIVER_POSITION_STABILITY_HORIZONTAL_M
+#else
+#define NEOM8X_HORIZONTAL_STABILITY_THRESHOLD_M 255
+#endif
+#ifdef NEOM8X_DRIVER_POSITION_STABILITY_VERTICAL_M
+#define NEOM8X_VERTICAL_STABILITY_THRESHOLD_M   NEOM8X_DRIVER_POSITION_STABILITY_VERTICAL_M
+#else
+#define NEOM8X_VERTICAL_STABILITY_THRESHOLD_M   0
+#endif
 #endif
 #if (NEOM8X_DRIVER_ALTITUDE_STABILITY_FILTER_MODE == 2)
 #define NEOM8X_ALTITUDE_STABILITY_THRESHOLD     (neom8x_ctx.acquisition.altitude_stability_threshold)
+#define NEOM8X_HORIZONTAL_STABILITY_THRESHOLD_M (neom8x_ctx.acquisition.horizontal_stability_threshold_m)
+#define NEOM8X_VERTICAL_STABILITY_THRESHOLD_M   (neom8x_ctx.acquisition.vertical_stability_threshold_m)
+#endif
+#define NEOM8X_STABILITY_WINDOW_SIZE_MAX        16
+#define NEOM8X_MINUTE_FRACTIONS_PER_MINUTE      100000
+#define NEOM8X_METERS_PER_MINUTE                1852
+#define NEOM8X_COSINE_ONE                       1024
+#define NEOM8X_HDOP_MAX                         255
+#define NEOM8X_SKY_TREND_EPOCHS_MIN             10
+#define NEOM8X_SKY_TREND_UNREACHABLE            0xFFFFFFFF
+
+#if (NEOM8X_DRIVER_ALTITUDE_STABILITY_FILTER_MODE == 1)
+#ifndef NEOM8X_DRIVER_ALTITUDE_STABILITY_THRESHOLD
+#error "NEOM8X_DRIVER_ALTITUDE_STABILITY_THRESHOLD is required in stability filter mode 1"
+#endif
+#if ((NEOM8X_HORIZONTAL_STABILITY_THRESHOLD_M > 255) || (NEOM8X_VERTICAL_STABILITY_THRESHOLD_M > 255))
+#error "NEOM8X_DRIVER_POSITION_STABILITY_HORIZONTAL_M and NEOM8X_DRIVER_POSITION_STABILITY_VERTICAL_M must not exceed 255 meters"
+#endif
+#if (NEOM8X_DRIVER_ALTITUDE_STABILITY_THRESHOLD > NEOM8X_STABILITY_WINDOW_SIZE_MAX)
+#error "NEOM8X_DRIVER_ALTITUDE_STABILITY_THRESHOLD must not exceed 16 fixes"
+#endif
 #endif
 
 /*** NEOM8X local structures ***/
 
 /*******************************************************************/
 typedef enum {
-    NEOM8X_NMEA_MESSAGE_INDEX_DTM = 0,
-    NEOM8X_NMEA_MESSAGE_INDEX_GBQ,
-    NEOM8X_NMEA_MESSAGE_INDEX_GGS,
-    NEOM8X_NMEA_MESSAGE_INDEX_GGA,
-    NEOM8X_NMEA_MESSAGE_INDEX_GLL,
-    NEOM8X_NMEA_MESSAGE_INDEX_GLQ,
-    NEOM8X_NMEA_MESSAGE_INDEX_GNQ,
-    NEOM8X_NMEA_MESSAGE_INDEX_GNS,
-    NEOM8X_NMEA_MESSAGE_INDEX_GPQ,
-    NEOM8X_NMEA_MESSAGE_INDEX_GRS,
-    NEOM8X_NMEA_MESSAGE_INDEX_GSA,
-    NEOM8X_NMEA_MESSAGE_INDEX_GST,
-    NEOM8X_NMEA_MESSAGE_INDEX_GSV,
-    NEOM8X_NMEA_MESSAGE_INDEX_RMC,
-    NEOM8X_NMEA_MESSAGE_INDEX_TXT,
-    NEOM8X_NMEA_MESSAGE_INDEX_VLW,
-    NEOM8X_NMEA_MESSAGE_INDEX_VTG,
-    NEOM8X_NMEA_MESSAGE_INDEX_ZDA,
-    NEOM8X_NMEA_MESSAGE_INDEX_LAST
-} NEOM8X_nmea_message_index_t;
+    NEOM8X_RX_STATE_IDLE = 0,
+    NEOM8X_RX_STATE_NMEA_ADDRESS,
+    NEOM8X_RX_STATE_NMEA_DATA,
+    NEOM8X_RX_STATE_NMEA_CHECKSUM_HIGH,
+    NEOM8X_RX_STATE_NMEA_CHECKSUM_LOW,
+    NEOM8X_RX_STATE_NMEA_END,
+    NEOM8X_RX_STATE_UBX_SYNC_CHAR_2,
+    NEOM8X_RX_STATE_UBX_HEADER,
+    NEOM8X_RX_STATE_UBX_PAYLOAD,
+    NEOM8X_RX_STATE_UBX_CHECKSUM_A,
+    NEOM8X_RX_STATE_UBX_CHECKSUM_B,
+    NEOM8X_RX_STATE_LAST
+} NEOM8X_rx_state_t;
+
+/*******************************************************************/
+typedef enum {
+    // Steps 0 to (NEOM8X_NMEA_MESSAGE_INDEX_LAST - 1) configure the NMEA messages rate.
+    NEOM8X_CONFIGURATION_STEP_PORT = NEOM8X_NMEA_MESSAGE_INDEX_LAST,
+    NEOM8X_CONFIGURATION_STEP_RATE,
+#ifdef NEOM8X_DRIVER_UBX_NAV_PVT
+    NEOM8X_CONFIGURATION_STEP_UBX_NAV_PVT,
+#endif
+#ifdef NEOM8X_DRIVER_POWER_SAVE
+    NEOM8X_CONFIGURATION_STEP_POWER_SAVE,
+    NEOM8X_CONFIGURATION_STEP_LOW_POWER_MODE,
+#endif
+    NEOM8X_CONFIGURATION_STEP_LAST
+} NEOM8X_configuration_step_t;
+
+/*******************************************************************/
+typedef enum {
+    NEOM8X_BAUD_RATE_SWITCH_STATE_IDLE = 0,
+    NEOM8X_BAUD_RATE_SWITCH_STATE_DELAY,
+    NEOM8X_BAUD_RATE_SWITCH_STATE_CONFIRMATION,
+    NEOM8X_BAUD_RATE_SWITCH_STATE_LAST
+} NEOM8X_baud_rate_switch_state_t;
+
+/*******************************************************************/
+typedef struct {
+    uint32_t nmea_message_mask;
+    uint8_t port_output_protocol_mask;
+    uint16_t measurement_period_ms;
+#ifdef NEOM8X_DRIVER_UBX_NAV_PVT
+    uint8_t ubx_nav_pvt_rate;
+#endif
+#ifdef NEOM8X_DRIVER_POWER_SAVE
+    uint8_t power_save_mode;
+    uint32_t power_save_period_ms;
+    uint8_t low_power_flag;
+#endif
+} NEOM8X_receiver_configuration_t;
+
+#if ((defined NEOM8X_DRIVER_GPS_DATA_POSITION) && (NEOM8X_DRIVER_ALTITUDE_STABILITY_FILTER_MODE > 0))
+/*******************************************************************/
+typedef struct {
+    int32_t latitude;
+    int32_t longitude;
+    uint32_t altitude;
+} NEOM8X_stability_sample_t;
+#endif
 
 /*******************************************************************/
 typedef enum {
@@ -138,64 +352,645 @@ typedef enum {
     NEOM8X_NMEA_GGA_FIELD_SIZE_DIFF_STATION = 0
 } NMEA_gga_field_size_t;
 
+/*******************************************************************/
+typedef enum {
+    NEOM8X_NMEA_RMC_FIELD_INDEX_MESSAGE = 0,
+    NEOM8X_NMEA_RMC_FIELD_INDEX_TIME,
+    NEOM8X_NMEA_RMC_FIELD_INDEX_STATUS,
+    NEOM8X_NMEA_RMC_FIELD_INDEX_LAT,
+    NEOM8X_NMEA_RMC_FIELD_INDEX_NS,
+    NEOM8X_NMEA_RMC_FIELD_INDEX_LONG,
+    NEOM8X_NMEA_RMC_FIELD_INDEX_EW,
+    NEOM8X_NMEA_RMC_FIELD_INDEX_SPD,
+    NEOM8X_NMEA_RMC_FIELD_INDEX_COG,
+    NEOM8X_NMEA_RMC_FIELD_INDEX_DATE,
+    NEOM8X_NMEA_RMC_FIELD_INDEX_MV,
+    NEOM8X_NMEA_RMC_FIELD_INDEX_MV_EW,
+    NEOM8X_NMEA_RMC_FIELD_INDEX_POS_MODE,
+    NEOM8X_NMEA_RMC_FIELD_INDEX_NAV_STATUS
+} NMEA_rmc_field_index_t;
+
+/*******************************************************************/
+typedef enum {
+    NEOM8X_NMEA_RMC_FIELD_SIZE_MESSAGE = 5,
+    NEOM8X_NMEA_RMC_FIELD_SIZE_TIME = 9,
+    NEOM8X_NMEA_RMC_FIELD_SIZE_STATUS = 1,
+    NEOM8X_NMEA_RMC_FIELD_SIZE_LAT = 10,
+    NEOM8X_NMEA_RMC_FIELD_SIZE_NS = 1,
+    NEOM8X_NMEA_RMC_FIELD_SIZE_LONG = 11,
+    NEOM8X_NMEA_RMC_FIELD_SIZE_EW = 1,
+    NEOM8X_NMEA_RMC_FIELD_SIZE_DATE = 6
+} NMEA_rmc_field_size_t;
+
+#ifdef NEOM8X_DRIVER_UBX_NAV_PVT
+/*******************************************************************/
+typedef enum {
+    NEOM8X_UBX_NAV_PVT_OFFSET_YEAR = 4,
+    NEOM8X_UBX_NAV_PVT_OFFSET_MONTH = 6,
+    NEOM8X_UBX_NAV_PVT_OFFSET_DAY = 7,
+    NEOM8X_UBX_NAV_PVT_OFFSET_HOUR = 8,
+    NEOM8X_UBX_NAV_PVT_OFFSET_MIN = 9,
+    NEOM8X_UBX_NAV_PVT_OFFSET_SEC = 10,
+    NEOM8X_UBX_NAV_PVT_OFFSET_VALID = 11,
+    NEOM8X_UBX_NAV_PVT_OFFSET_FIX_TYPE = 20,
+    NEOM8X_UBX_NAV_PVT_OFFSET_FLAGS = 21,
+    NEOM8X_UBX_NAV_PVT_OFFSET_NUMSV = 23,
+    NEOM8X_UBX_NAV_PVT_OFFSET_LON = 24,
+    NEOM8X_UBX_NAV_PVT_OFFSET_LAT = 28,
+    NEOM8X_UBX_NAV_PVT_OFFSET_HMSL = 36,
+    NEOM8X_UBX_NAV_PVT_OFFSET_PDOP = 76
+} NEOM8X_ubx_nav_pvt_offset_t;
+#endif
+
+/*******************************************************************/
+typedef struct {
+    char_t* buffer;
+    uint8_t number_of_fields;
+    uint8_t field_offset[NEOM8X_NMEA_FIELD_NUMBER_MAX + 1];
+} NEOM8X_nmea_sentence_t;
+
 /*******************************************************************/
 typedef struct {
-    // Buffers.
-    volatile char_t nmea_buffer[NEOM8X_NMEA_RX_BUFFER_DEPTH][NEOM8X_NMEA_RX_BUFFER_SIZE_BYTES];
-    volatile uint8_t nmea_char_idx;
-    volatile uint8_t nmea_buffer_idx_write;
-    volatile uint8_t nmea_buffer_idx_ready;
-    volatile uint8_t nmea_frame_received_flag;
+    // Reception ring buffer (written by the RX interrupt, read by the process function).
+    volatile char_t rx_buffer[NEOM8X_RX_BUFFER_DEPTH][NEOM8X_RX_BUFFER_SIZE_BYTES];
+    volatile uint8_t rx_char_idx;
+    volatile uint8_t rx_write_idx;
+    volatile uint8_t rx_read_idx;
+    volatile NEOM8X_rx_state_t rx_state;
+    volatile char_t nmea_address[NEOM8X_NMEA_ADDRESS_SIZE_BYTES];
+    volatile uint8_t nmea_computed_checksum;
+    volatile uint32_t nmea_message_mask;
+#ifdef NEOM8X_DRIVER_SENTENCE_VIEW
+    volatile uint32_t sentence_view_mask;
+#endif
+    volatile uint8_t ubx_header[NEOM8X_UBX_HEADER_SIZE_BYTES];
+    volatile uint8_t ubx_payload[NEOM8X_UBX_RX_PAYLOAD_SIZE_BYTES];
+    volatile uint16_t ubx_payload_size;
+    volatile uint8_t ubx_ck_a;
+    volatile uint8_t ubx_ck_b;
+#ifdef NEOM8X_DRIVER_UBX_NAV_PVT
+    volatile uint8_t ubx_nav_pvt_subscribed_flag;
+    volatile uint8_t ubx_frame_buffered_flag;
+#endif
+    // UBX acknowledge.
+    volatile uint8_t ubx_ack_received_flag;
+    volatile uint8_t ubx_ack_id;
+    volatile uint8_t ubx_ack_class_id[NEOM8X_UBX_ACK_PAYLOAD_SIZE_BYTES];
+    uint8_t ubx_command_class_id[NEOM8X_UBX_ACK_PAYLOAD_SIZE_BYTES];
+#ifdef NEOM8X_DRIVER_UBX_MGA
+    // Aiding acknowledge.
+    volatile uint8_t mga_ack_received_flag;
+    volatile uint8_t mga_ack[NEOM8X_UBX_MGA_ACK_PAYLOAD_SIZE_BYTES];
+#endif
+#ifdef NEOM8X_DRIVER_UBX_SOS
+    // Save on shutdown.
+    volatile uint8_t sos_response_received_flag;
+    volatile uint8_t sos_command;
+    volatile uint8_t sos_response;
+    volatile NEOM8X_backup_restore_status_t backup_restore_status;
+    uint8_t gnss_stopped_flag;
+#endif
+    // Configuration pipeline.
+    uint8_t configuration_step;
+    uint8_t configuration_retry_count;
+    volatile uint8_t timer_irq_flag;
+    // UART link (requested baud rate is applied by the next configuration pipeline).
+    uint32_t uart_baud_rate;
+    uint32_t requested_uart_baud_rate;
+    NEOM8X_baud_rate_switch_state_t baud_rate_switch_state;
+    uint8_t baud_rate_fallback_flag;
+    // Receiver configuration (requested and cached).
+    NEOM8X_receiver_configuration_t configuration;
+    NEOM8X_receiver_configuration_t applied_configuration;
+    uint32_t known_configuration_mask;
+    volatile uint8_t module_reset_detected_flag;
+#ifdef NEOM8X_DRIVER_POWER_SAVE
+    uint8_t module_sleeping_flag;
+#endif
+    // Statistics.
+    volatile NEOM8X_statistics_t statistics;
     // Local data.
     NEOM8X_acquisition_t acquisition;
+    uint8_t acquisition_started_flag;
+#ifdef NEOM8X_DRIVER_SENTENCE_VIEW
+    NEOM8X_sentence_cb_t sentence_view_callback;
+#endif
 #ifdef NEOM8X_DRIVER_GPS_DATA_TIME
     NEOM8X_time_t gps_time;
 #endif
 #ifdef NEOM8X_DRIVER_GPS_DATA_POSITION
     NEOM8X_position_t gps_position;
 #endif
+#ifdef NEOM8X_DRIVER_GPS_DATA_POSITION
+    NEOM8X_position_e7_t gps_position_e7;
+    NEOM8X_fix_quality_t fix_quality;
+    NEOM8X_acquisition_status_t position_status;
+    uint32_t position_epoch_count;
+    uint8_t position_abort_flag;
+    // Consecutive fixes rejected by the satellites or HDOP gates.
+    NEOM8X_fix_quality_t sky_trend_first;
+    NEOM8X_fix_quality_t sky_trend_last;
+    uint32_t sky_trend_epoch_count;
+#endif
 #if ((defined NEOM8X_DRIVER_GPS_DATA_POSITION) && (NEOM8X_DRIVER_ALTITUDE_STABILITY_FILTER_MODE > 0))
-    // Altitude stability filter.
-    uint8_t same_altitude_count;
-    uint32_t previous_altitude;
+    // Position stability filter.
+    NEOM8X_stability_sample_t stability_window[NEOM8X_STABILITY_WINDOW_SIZE_MAX];
+    uint8_t stability_window_idx;
+    uint8_t stability_sample_count;
 #endif
 } NEOM8X_context_t;
 
 /*** NEOM8X local global variables ***/
 
+// See p.110 for NMEA messages ID.
+static const uint8_t NEOM8X_NMEA_MESSAGE_ID[NEOM8X_NMEA_MESSAGE_INDEX_LAST] = {
+    0x0A, // DTM.
+    0x44, // GBQ.
+    0x09, // GBS.
+    0x00, // GGA.
+    0x01, // GLL.
+    0x43, // GLQ.
+    0x42, // GNQ.
+    0x0D, // GNS.
+    0x40, // GPQ.
+    0x06, // GRS.
+    0x02, // GSA.
+    0x07, // GST.
+    0x03, // GSV.
+    0x04, // RMC.
+    0x41, // TXT.
+    0x0F, // VLW.
+    0x05, // VTG.
+    0x08  // ZDA.
+};
+static const char_t NEOM8X_NMEA_MESSAGE_NAME[NEOM8X_NMEA_MESSAGE_INDEX_LAST][NEOM8X_NMEA_MESSAGE_NAME_SIZE_BYTES] = {
+    { 'D', 'T', 'M' },
+    { 'G', 'B', 'Q' },
+    { 'G', 'B', 'S' },
+    { 'G', 'G', 'A' },
+    { 'G', 'L', 'L' },
+    { 'G', 'L', 'Q' },
+    { 'G', 'N', 'Q' },
+    { 'G', 'N', 'S' },
+    { 'G', 'P', 'Q' },
+    { 'G', 'R', 'S' },
+    { 'G', 'S', 'A' },
+    { 'G', 'S', 'T' },
+    { 'G', 'S', 'V' },
+    { 'R', 'M', 'C' },
+    { 'T', 'X', 'T' },
+    { 'V', 'L', 'W' },
+    { 'V', 'T', 'G' },
+    { 'Z', 'D', 'A' }
+};
+
+#if ((defined NEOM8X_DRIVER_GPS_DATA_POSITION) && (NEOM8X_DRIVER_ALTITUDE_STABILITY_FILTER_MODE > 0))
+// Cosine of the lower bound of each 10 degrees latitude band (east-west distances are over-estimated).
+static const uint16_t NEOM8X_LATITUDE_BAND_COSINE[9] = { 1024, 1008, 962, 887, 784, 658, 512, 350, 178 };
+#endif
+
 static NEOM8X_context_t neom8x_ctx;
 
 /*** NEOM8X local functions ***/
 
 /*******************************************************************/
-#define _NEOM8X_check_field_size(field_size) { if ((char_idx - separator_idx) != (field_size + 1)) goto errors; }
+#define _NEOM8X_get_field(field_idx) (&((nmea_sentence->buffer)[(nmea_sentence->field_offset)[field_idx]]))
+
+/*******************************************************************/
+#define _NEOM8X_get_field_size(field_idx) ((uint8_t) ((nmea_sentence->field_offset)[(field_idx) + 1] - (nmea_sentence->field_offset)[field_idx] - 1))
+
+/*******************************************************************/
+#define _NEOM8X_check_field_size(field_idx, field_size) { if (_NEOM8X_get_field_size(field_idx) != (field_size)) { neom8x_ctx.statistics.field_size_error_count++; goto errors; } }
+
+/*******************************************************************/
+#define _NEOM8X_update_ubx_checksum(ck_a, ck_b, ubx_byte) { ck_a = (uint8_t) (ck_a + (ubx_byte)); ck_b = (uint8_t) (ck_b + ck_a); }
+
+/*******************************************************************/
+#define _NEOM8X_decode_decimal_field(str, number_of_digits, value) { if (_NEOM8X_decode_decimal(str, number_of_digits, value) == 0) goto errors; }
+
+/*******************************************************************/
+static uint8_t _NEOM8X_hexadecimal_char_to_value(uint8_t hexadecimal_char) {
+    // Local variables.
+    uint8_t value = 0xFF;
+    // Convert character.
+    if ((hexadecimal_char >= '0') && (hexadecimal_char <= '9')) {
+        value = (uint8_t) (hexadecimal_char - '0');
+    }
+    else if ((hexadecimal_char >= 'A') && (hexadecimal_char <= 'F')) {
+        value = (uint8_t) (hexadecimal_char - 'A' + 10);
+    }
+    return value;
+}
+
+#if ((defined NEOM8X_DRIVER_GPS_DATA_TIME) || (defined NEOM8X_DRIVER_GPS_DATA_POSITION))
+#if (NEOM8X_DECIMAL_DECODER_SWAR != 0)
+/*******************************************************************/
+static uint8_t _NEOM8X_decode_decimal(char_t* str, uint8_t number_of_digits, uint32_t* value) {
+    // Local variables.
+    uint8_t success_flag = 0;
+    uint64_t chunk = 0;
+    uint8_t idx = 0;
+    // Check parameter.
+    if ((number_of_digits == 0) || (number_of_digits > NEOM8X_DECIMAL_DIGITS_MAX)) goto errors;
+    // Load characters in the upper lanes and pad lower lanes with '0' (first character is the most significant digit).
+    for (idx = 0; idx < number_of_digits; idx++) {
+        chunk |= ((uint64_t) ((uint8_t) str[idx])) << (8 * idx);
+    }
+    chunk <<= (8 * (NEOM8X_DECIMAL_DIGITS_MAX - number_of_digits));
+    if (number_of_digits < NEOM8X_DECIMAL_DIGITS_MAX) {
+        chunk |= (NEOM8X_SWAR_CHAR_0 >> (8 * number_of_digits));
+    }
+    // Check that all characters are digits.
+    if ((((chunk + NEOM8X_SWAR_CHAR_9_OVERFLOW) | (chunk - NEOM8X_SWAR_CHAR_0)) & NEOM8X_SWAR_LANE_MSB) != 0) goto errors;
+    // Combine digits by pairs, then by groups of 4 and 8.
+    chunk -= NEOM8X_SWAR_CHAR_0;
+    chunk = ((chunk * 10) + (chunk >> 8)) & 0x00FF00FF00FF00FF;
+    chunk = ((chunk * 100) + (chunk >> 16)) & 0x0000FFFF0000FFFF;
+    chunk = ((chunk * 10000) + (chunk >> 32)) & 0x00000000FFFFFFFF;
+    (*value) = (uint32_t) chunk;
+    success_flag = 1;
+errors:
+    return success_flag;
+}
+#else
+/*******************************************************************/
+static uint8_t _NEOM8X_decode_decimal(char_t* str, uint8_t number_of_digits, uint32_t* value) {
+    // Local variables.
+    uint8_t success_flag = 0;
+    uint32_t result = 0;
+    uint8_t invalid_flag = 0;
+    uint8_t digit = 0;
+    uint8_t idx = 0;
+    // Check parameter.
+    if ((number_of_digits == 0) || (number_of_digits > NEOM8X_DECIMAL_DIGITS_MAX)) goto errors;
+    // Accumulate digits, validity is checked once at the end.
+    for (idx = 0; idx < number_of_digits; idx++) {
+        digit = (uint8_t) (str[idx] - '0');
+        invalid_flag |= (digit > 9);
+        result = (result * 10) + digit;
+    }
+    if (invalid_flag != 0) goto errors;
+    (*value) = result;
+    success_flag = 1;
+errors:
+    return success_flag;
+}
+#endif
+#endif
+
+/*******************************************************************/
+static uint8_t _NEOM8X_decode_hexadecimal(char_t* str, uint8_t number_of_digits, uint32_t* value) {
+    // Local variables.
+    uint8_t success_flag = 0;
+    uint32_t result = 0;
+    uint8_t invalid_flag = 0;
+    uint8_t digit = 0;
+    uint8_t idx = 0;
+    // Check parameter.
+    if ((number_of_digits == 0) || (number_of_digits > NEOM8X_HEXADECIMAL_DIGITS_MAX)) goto errors;
+    // Accumulate digits, validity is checked once at the end.
+    for (idx = 0; idx < number_of_digits; idx++) {
+        digit = _NEOM8X_hexadecimal_char_to_value((uint8_t) str[idx]);
+        invalid_flag |= (digit > 0x0F);
+        result = (result << 4) | (digit & 0x0F);
+    }
+    if (invalid_flag != 0) goto errors;
+    (*value) = result;
+    success_flag = 1;
+errors:
+    return success_flag;
+}
 
 /*******************************************************************/
-#define _NEOM8X_check_string_status(void) { if (string_status != STRING_SUCCESS) goto errors; }
+static uint8_t _NEOM8X_check_nmea_address(void) {
+    // Local variables.
+    uint8_t subscribed_flag = 0;
+    uint32_t nmea_reception_mask = neom8x_ctx.nmea_message_mask;
+    uint32_t nmea_message_bit = 0;
+    uint8_t nmea_idx = 0;
+#ifdef NEOM8X_DRIVER_SENTENCE_VIEW
+    nmea_reception_mask |= neom8x_ctx.sentence_view_mask;
+#endif
+    // Search message name.
+    for (nmea_idx = 0; nmea_idx < NEOM8X_NMEA_MESSAGE_INDEX_LAST; nmea_idx++) {
+        if ((neom8x_ctx.nmea_address[NEOM8X_NMEA_MESSAGE_NAME_OFFSET + 0] == NEOM8X_NMEA_MESSAGE_NAME[nmea_idx][0]) &&
+            (neom8x_ctx.nmea_address[NEOM8X_NMEA_MESSAGE_NAME_OFFSET + 1] == NEOM8X_NMEA_MESSAGE_NAME[nmea_idx][1]) &&
+            (neom8x_ctx.nmea_address[NEOM8X_NMEA_MESSAGE_NAME_OFFSET + 2] == NEOM8X_NMEA_MESSAGE_NAME[nmea_idx][2]))
+        {
+            break;
+        }
+    }
+    if (nmea_idx >= NEOM8X_NMEA_MESSAGE_INDEX_LAST) goto errors;
+    nmea_message_bit = (0b1 << nmea_idx);
+    // Check subscription.
+    if ((nmea_reception_mask & nmea_message_bit) != 0) {
+        subscribed_flag = 1;
+        goto errors;
+    }
+    // Check if the message is received while it has been disabled, meaning that the module has lost its configuration.
+    if (neom8x_ctx.configuration_step < NEOM8X_CONFIGURATION_STEP_LAST) goto errors;
+    if ((((neom8x_ctx.known_configuration_mask & (0b1 << NEOM8X_CONFIGURATION_STEP_PORT)) != 0) && ((neom8x_ctx.applied_configuration.port_output_protocol_mask & NEOM8X_UBX_PROTOCOL_NMEA) == 0)) ||
+        (((neom8x_ctx.known_configuration_mask & nmea_message_bit) != 0) && ((neom8x_ctx.applied_configuration.nmea_message_mask & nmea_message_bit) == 0)))
+    {
+        neom8x_ctx.module_reset_detected_flag = 1;
+    }
+errors:
+    return subscribed_flag;
+}
 
 /*******************************************************************/
 static void _NEOM8X_rx_irq_callback(uint8_t message_byte) {
-    // Store new byte.
-    neom8x_ctx.nmea_buffer[neom8x_ctx.nmea_buffer_idx_write][neom8x_ctx.nmea_char_idx] = (char_t) message_byte;
-    // Manage character index.
-    neom8x_ctx.nmea_char_idx++;
-    // Check buffer size and NMEA ending marker.
-    if ((message_byte == NEOM8X_NMEA_CHAR_END) || (neom8x_ctx.nmea_char_idx >= NEOM8X_NMEA_RX_BUFFER_SIZE_BYTES)) {
-        // Check ending marker.
-        if (message_byte == NEOM8X_NMEA_CHAR_END) {
-            // Update flag.
-            neom8x_ctx.nmea_frame_received_flag = 1;
-            neom8x_ctx.nmea_buffer_idx_ready = neom8x_ctx.nmea_buffer_idx_write;
-        }
-        // Switch buffer.
-        neom8x_ctx.nmea_buffer_idx_write = (uint8_t) ((neom8x_ctx.nmea_buffer_idx_write + 1) % NEOM8X_NMEA_RX_BUFFER_DEPTH);
-        neom8x_ctx.nmea_char_idx = 0;
+    // Local variables.
+    uint32_t received_checksum = 0;
+    uint8_t idx = 0;
+    // Update byte counter.
+    neom8x_ctx.statistics.rx_byte_count++;
+    // Resynchronize on NMEA start character whatever the current NMEA state.
+    if ((message_byte == NEOM8X_NMEA_CHAR_MESSAGE_START) && (neom8x_ctx.rx_state < NEOM8X_RX_STATE_UBX_SYNC_CHAR_2)) {
+        neom8x_ctx.nmea_address[0] = (char_t) message_byte;
+        neom8x_ctx.rx_char_idx = 1;
+        neom8x_ctx.nmea_computed_checksum = 0;
+        neom8x_ctx.rx_state = NEOM8X_RX_STATE_NMEA_ADDRESS;
+        goto end;
+    }
+    // Store NMEA bytes in the current slot.
+    if ((neom8x_ctx.rx_state >= NEOM8X_RX_STATE_NMEA_DATA) && (neom8x_ctx.rx_state <= NEOM8X_RX_STATE_NMEA_END)) {
+        // Check buffer size.
+        if (neom8x_ctx.rx_char_idx >= NEOM8X_RX_BUFFER_SIZE_BYTES) {
+            neom8x_ctx.statistics.buffer_overflow_count++;
+            goto frame_error;
+        }
+        neom8x_ctx.rx_buffer[neom8x_ctx.rx_write_idx & NEOM8X_RX_BUFFER_INDEX_MASK][neom8x_ctx.rx_char_idx] = (char_t) message_byte;
+        neom8x_ctx.rx_char_idx++;
+    }
+    // Frame state machine (see NMEA and UBX messages format on p.105 and p.134 of NEO-M8 programming manual).
+    switch (neom8x_ctx.rx_state) {
+    case NEOM8X_RX_STATE_IDLE:
+        // Wait for UBX preamble.
+        if (message_byte == NEOM8X_UBX_SYNC_CHAR_1) {
+            neom8x_ctx.rx_state = NEOM8X_RX_STATE_UBX_SYNC_CHAR_2;
+        }
+        break;
+    case NEOM8X_RX_STATE_NMEA_ADDRESS:
+        // Address field is buffered locally until the message is known to be subscribed.
+        neom8x_ctx.nmea_address[neom8x_ctx.rx_char_idx] = (char_t) message_byte;
+        neom8x_ctx.nmea_computed_checksum ^= message_byte;
+        neom8x_ctx.rx_char_idx++;
+        if (neom8x_ctx.rx_char_idx < NEOM8X_NMEA_ADDRESS_SIZE_BYTES) break;
+        // Drop unsubscribed messages.
+        if (_NEOM8X_check_nmea_address() == 0) goto frame_error;
+        // Check if a free slot is available.
+        if (((uint8_t) (neom8x_ctx.rx_write_idx - neom8x_ctx.rx_read_idx)) >= NEOM8X_RX_BUFFER_DEPTH) {
+            neom8x_ctx.statistics.frame_dropped_count++;
+            goto frame_error;
+        }
+        // Copy address field into the slot.
+        for (idx = 0; idx < NEOM8X_NMEA_ADDRESS_SIZE_BYTES; idx++) {
+            neom8x_ctx.rx_buffer[neom8x_ctx.rx_write_idx & NEOM8X_RX_BUFFER_INDEX_MASK][idx] = neom8x_ctx.nmea_address[idx];
+        }
+        neom8x_ctx.rx_state = NEOM8X_RX_STATE_NMEA_DATA;
+        break;
+    case NEOM8X_RX_STATE_NMEA_DATA:
+        if (message_byte == NEOM8X_NMEA_CHAR_CHECKSUM_START) {
+            neom8x_ctx.rx_state = NEOM8X_RX_STATE_NMEA_CHECKSUM_HIGH;
+        }
+        else if ((message_byte == NEOM8X_NMEA_CHAR_CR) || (message_byte == NEOM8X_NMEA_CHAR_END)) {
+            goto frame_error;
+        }
+        else {
+            // Exclusive OR of all characters between '$' and '*'.
+            neom8x_ctx.nmea_computed_checksum ^= message_byte;
+        }
+        break;
+    case NEOM8X_RX_STATE_NMEA_CHECKSUM_HIGH:
+        // Checksum characters are decoded at once from the slot.
+        neom8x_ctx.rx_state = NEOM8X_RX_STATE_NMEA_CHECKSUM_LOW;
+        break;
+    case NEOM8X_RX_STATE_NMEA_CHECKSUM_LOW:
+        if (_NEOM8X_decode_hexadecimal((char_t*) &(neom8x_ctx.rx_buffer[neom8x_ctx.rx_write_idx & NEOM8X_RX_BUFFER_INDEX_MASK][neom8x_ctx.rx_char_idx - NEOM8X_NMEA_CHECKSUM_SIZE_BYTES]), NEOM8X_NMEA_CHECKSUM_SIZE_BYTES, &received_checksum) == 0) goto checksum_error;
+        // Verify checksum.
+        if (received_checksum != neom8x_ctx.nmea_computed_checksum) goto checksum_error;
+        neom8x_ctx.rx_state = NEOM8X_RX_STATE_NMEA_END;
+        break;
+    case NEOM8X_RX_STATE_NMEA_END:
+        // Skip carriage return.
+        if (message_byte == NEOM8X_NMEA_CHAR_CR) break;
+        if (message_byte != NEOM8X_NMEA_CHAR_END) goto frame_error;
+        // Valid frame: publish slot.
+        neom8x_ctx.rx_write_idx++;
+        neom8x_ctx.statistics.frame_count++;
+        neom8x_ctx.rx_state = NEOM8X_RX_STATE_IDLE;
+        // Ask for processing.
+        if (neom8x_ctx.acquisition.process_callback != NULL) {
+            neom8x_ctx.acquisition.process_callback();
+        }
+        break;
+    case NEOM8X_RX_STATE_UBX_SYNC_CHAR_2:
+        if (message_byte != NEOM8X_UBX_SYNC_CHAR_2) goto frame_error;
+        // Reset checksum.
+        neom8x_ctx.ubx_ck_a = 0;
+        neom8x_ctx.ubx_ck_b = 0;
+        neom8x_ctx.rx_char_idx = 0;
+        neom8x_ctx.rx_state = NEOM8X_RX_STATE_UBX_HEADER;
+        break;
+    case NEOM8X_RX_STATE_UBX_HEADER:
+        // Store class, ID and length.
+        neom8x_ctx.ubx_header[neom8x_ctx.rx_char_idx] = message_byte;
+        _NEOM8X_update_ubx_checksum(neom8x_ctx.ubx_ck_a, neom8x_ctx.ubx_ck_b, message_byte);
+        neom8x_ctx.rx_char_idx++;
+        if (neom8x_ctx.rx_char_idx < NEOM8X_UBX_HEADER_SIZE_BYTES) break;
+        neom8x_ctx.ubx_payload_size = (uint16_t) (neom8x_ctx.ubx_header[2] | (neom8x_ctx.ubx_header[3] << 8));
+#ifdef NEOM8X_DRIVER_UBX_NAV_PVT
+        neom8x_ctx.ubx_frame_buffered_flag = 0;
+        // Navigation messages are stored in the ring buffer.
+        if ((neom8x_ctx.ubx_header[0] == NEOM8X_UBX_CLASS_NAV) && (neom8x_ctx.ubx_header[1] == NEOM8X_UBX_ID_NAV_PVT) && (neom8x_ctx.ubx_payload_size == NEOM8X_UBX_NAV_PVT_PAYLOAD_SIZE_BYTES) && (neom8x_ctx.ubx_nav_pvt_subscribed_flag != 0)) {
+            // Check if a free slot is available.
+            if (((uint8_t) (neom8x_ctx.rx_write_idx - neom8x_ctx.rx_read_idx)) >= NEOM8X_RX_BUFFER_DEPTH) {
+                neom8x_ctx.statistics.frame_dropped_count++;
+                goto frame_error;
+            }
+            // Copy preamble and header into the slot.
+            neom8x_ctx.rx_buffer[neom8x_ctx.rx_write_idx & NEOM8X_RX_BUFFER_INDEX_MASK][0] = (char_t) NEOM8X_UBX_SYNC_CHAR_1;
+            neom8x_ctx.rx_buffer[neom8x_ctx.rx_write_idx & NEOM8X_RX_BUFFER_INDEX_MASK][1] = (char_t) NEOM8X_UBX_SYNC_CHAR_2;
+            for (idx = 0; idx < NEOM8X_UBX_HEADER_SIZE_BYTES; idx++) {
+                neom8x_ctx.rx_buffer[neom8x_ctx.rx_write_idx & NEOM8X_RX_BUFFER_INDEX_MASK][NEOM8X_UBX_CHECKSUM_OFFSET_BYTES + idx] = (char_t) neom8x_ctx.ubx_header[idx];
+            }
+            neom8x_ctx.ubx_frame_buffered_flag = 1;
+        }
+        else
+#endif
+#ifdef NEOM8X_DRIVER_UBX_MGA
+        if ((neom8x_ctx.ubx_header[0] == NEOM8X_UBX_CLASS_MGA) && (neom8x_ctx.ubx_header[1] == NEOM8X_UBX_ID_MGA_ACK)) {
+            // Aiding acknowledge messages are directly stored in the context.
+            if (neom8x_ctx.ubx_payload_size != NEOM8X_UBX_MGA_ACK_PAYLOAD_SIZE_BYTES) goto frame_error;
+        }
+        else
+#endif
+#ifdef NEOM8X_DRIVER_UBX_SOS
+        if ((neom8x_ctx.ubx_header[0] == NEOM8X_UBX_CLASS_UPD) && (neom8x_ctx.ubx_header[1] == NEOM8X_UBX_ID_UPD_SOS)) {
+            // Save on shutdown responses are directly stored in the context.
+            if (neom8x_ctx.ubx_payload_size != NEOM8X_UBX_UPD_SOS_RESPONSE_SIZE_BYTES) goto frame_error;
+        }
+        else
+#endif
+        // Acknowledge messages are directly stored in the context.
+        if ((neom8x_ctx.ubx_header[0] != NEOM8X_UBX_CLASS_ACK) || (neom8x_ctx.ubx_payload_size != NEOM8X_UBX_ACK_PAYLOAD_SIZE_BYTES)) goto frame_error;
+        neom8x_ctx.rx_char_idx = 0;
+        neom8x_ctx.rx_state = NEOM8X_RX_STATE_UBX_PAYLOAD;
+        break;
+    case NEOM8X_RX_STATE_UBX_PAYLOAD:
+        // Store payload.
+#ifdef NEOM8X_DRIVER_UBX_NAV_PVT
+        if (neom8x_ctx.ubx_frame_buffered_flag != 0) {
+            neom8x_ctx.rx_buffer[neom8x_ctx.rx_write_idx & NEOM8X_RX_BUFFER_INDEX_MASK][NEOM8X_UBX_PAYLOAD_OFFSET + neom8x_ctx.rx_char_idx] = (char_t) message_byte;
+        }
+        else
+#endif
+        neom8x_ctx.ubx_payload[neom8x_ctx.rx_char_idx] = message_byte;
+        _NEOM8X_update_ubx_checksum(neom8x_ctx.ubx_ck_a, neom8x_ctx.ubx_ck_b, message_byte);
+        neom8x_ctx.rx_char_idx++;
+        if (neom8x_ctx.rx_char_idx >= neom8x_ctx.ubx_payload_size) {
+            neom8x_ctx.rx_state = NEOM8X_RX_STATE_UBX_CHECKSUM_A;
+        }
+        break;
+    case NEOM8X_RX_STATE_UBX_CHECKSUM_A:
+        if (message_byte != neom8x_ctx.ubx_ck_a) goto checksum_error;
+        neom8x_ctx.rx_state = NEOM8X_RX_STATE_UBX_CHECKSUM_B;
+        break;
+    case NEOM8X_RX_STATE_UBX_CHECKSUM_B:
+        if (message_byte != neom8x_ctx.ubx_ck_b) goto checksum_error;
+        neom8x_ctx.statistics.frame_count++;
+#ifdef NEOM8X_DRIVER_UBX_NAV_PVT
+        if (neom8x_ctx.ubx_frame_buffered_flag != 0) {
+            // Valid navigation message: publish slot.
+            neom8x_ctx.rx_write_idx++;
+        }
+        else
+#endif
+#ifdef NEOM8X_DRIVER_UBX_MGA
+        if (neom8x_ctx.ubx_header[0] == NEOM8X_UBX_CLASS_MGA) {
+            // Valid aiding acknowledge: store type, info code, message ID and payload start of the acknowledged message.
+            for (idx = 0; idx < NEOM8X_UBX_MGA_ACK_PAYLOAD_SIZE_BYTES; idx++) {
+                neom8x_ctx.mga_ack[idx] = neom8x_ctx.ubx_payload[idx];
+            }
+            neom8x_ctx.mga_ack_received_flag = 1;
+        }
+        else
+#endif
+#ifdef NEOM8X_DRIVER_UBX_SOS
+        if (neom8x_ctx.ubx_header[0] == NEOM8X_UBX_CLASS_UPD) {
+            // Valid save on shutdown response: store command and response (the restore status is also sent by the module after boot).
+            neom8x_ctx.sos_command = neom8x_ctx.ubx_payload[0];
+            neom8x_ctx.sos_response = neom8x_ctx.ubx_payload[NEOM8X_UBX_UPD_SOS_RESPONSE_OFFSET];
+            if (neom8x_ctx.sos_command == NEOM8X_UBX_UPD_SOS_CMD_RESTORED) {
+                neom8x_ctx.backup_restore_status = neom8x_ctx.sos_response;
+            }
+            neom8x_ctx.sos_response_received_flag = 1;
+        }
+        else
+#endif
+        {
+            // Valid acknowledge: store acknowledged message.
+            neom8x_ctx.ubx_ack_id = neom8x_ctx.ubx_header[1];
+            neom8x_ctx.ubx_ack_class_id[0] = neom8x_ctx.ubx_payload[0];
+            neom8x_ctx.ubx_ack_class_id[1] = neom8x_ctx.ubx_payload[1];
+            neom8x_ctx.ubx_ack_received_flag = 1;
+        }
+        neom8x_ctx.rx_state = NEOM8X_RX_STATE_IDLE;
         // Ask for processing.
-        if ((message_byte == NEOM8X_NMEA_CHAR_END) && (neom8x_ctx.acquisition.process_callback != NULL)) {
+        if (neom8x_ctx.acquisition.process_callback != NULL) {
             neom8x_ctx.acquisition.process_callback();
         }
+        break;
+    default:
+        goto frame_error;
+    }
+    goto end;
+checksum_error:
+    neom8x_ctx.statistics.checksum_error_count++;
+frame_error:
+    // Drop current frame and wait for next start character.
+    neom8x_ctx.rx_state = NEOM8X_RX_STATE_IDLE;
+end:
+    return;
+}
+
+#ifdef NEOM8X_DRIVER_RX_BLOCK
+/*******************************************************************/
+static void _NEOM8X_rx_block_callback(uint8_t* data, uint32_t data_size_bytes) {
+    // Local variables.
+    volatile char_t* rx_slot = NULL;
+    uint32_t data_idx = 0;
+    uint32_t run_end_idx = 0;
+    uint8_t message_byte = 0;
+    uint8_t nmea_checksum = 0;
+    uint8_t char_idx = 0;
+    // Only the sentence body is framed in bulk, delimiters and UBX frames go through the byte state machine.
+    while (data_idx < data_size_bytes) {
+        switch (neom8x_ctx.rx_state) {
+        case NEOM8X_RX_STATE_IDLE:
+            // Skip bytes up to the next NMEA or UBX start character.
+            run_end_idx = data_idx;
+            while ((run_end_idx < data_size_bytes) && (data[run_end_idx] != NEOM8X_NMEA_CHAR_MESSAGE_START) && (data[run_end_idx] != NEOM8X_UBX_SYNC_CHAR_1)) {
+                run_end_idx++;
+            }
+            neom8x_ctx.statistics.rx_byte_count += (run_end_idx - data_idx);
+            data_idx = run_end_idx;
+            break;
+        case NEOM8X_RX_STATE_NMEA_DATA:
+            // Copy sentence body up to the next delimiter, within the free space of the slot.
+            rx_slot = neom8x_ctx.rx_buffer[neom8x_ctx.rx_write_idx & NEOM8X_RX_BUFFER_INDEX_MASK];
+            char_idx = neom8x_ctx.rx_char_idx;
+            nmea_checksum = neom8x_ctx.nmea_computed_checksum;
+            run_end_idx = data_idx + (uint32_t) (NEOM8X_RX_BUFFER_SIZE_BYTES - char_idx);
+            if (run_end_idx > data_size_bytes) {
+                run_end_idx = data_size_bytes;
+            }
+            while (data_idx < run_end_idx) {
+                message_byte = data[data_idx];
+                if ((message_byte == NEOM8X_NMEA_CHAR_CHECKSUM_START) || (message_byte == NEOM8X_NMEA_CHAR_MESSAGE_START) || (message_byte == NEOM8X_NMEA_CHAR_CR) || (message_byte == NEOM8X_NMEA_CHAR_END)) break;
+                rx_slot[char_idx] = (char_t) message_byte;
+                nmea_checksum ^= message_byte;
+                char_idx++;
+                data_idx++;
+            }
+            neom8x_ctx.statistics.rx_byte_count += (uint8_t) (char_idx - neom8x_ctx.rx_char_idx);
+            neom8x_ctx.rx_char_idx = char_idx;
+            neom8x_ctx.nmea_computed_checksum = nmea_checksum;
+            break;
+        default:
+            break;
+        }
+        // Give the byte which ended the run to the state machine.
+        if (data_idx < data_size_bytes) {
+            _NEOM8X_rx_irq_callback(data[data_idx]);
+            data_idx++;
+        }
     }
 }
+#endif
+
+/*******************************************************************/
+static void _NEOM8X_timer_irq_callback(void) {
+    // Set flag.
+    neom8x_ctx.timer_irq_flag = 1;
+    // Ask for processing.
+    if (neom8x_ctx.acquisition.process_callback != NULL) {
+        neom8x_ctx.acquisition.process_callback();
+    }
+}
+
+/*******************************************************************/
+static void _NEOM8X_reset_statistics(void) {
+    // Reset all counters.
+    neom8x_ctx.statistics.rx_byte_count = 0;
+    neom8x_ctx.statistics.frame_count = 0;
+    neom8x_ctx.statistics.buffer_overflow_count = 0;
+    neom8x_ctx.statistics.frame_dropped_count = 0;
+    neom8x_ctx.statistics.checksum_error_count = 0;
+    neom8x_ctx.statistics.field_size_error_count = 0;
+    neom8x_ctx.statistics.data_validity_error_count = 0;
+}
 
 #ifdef NEOM8X_DRIVER_GPS_DATA_TIME
 /*******************************************************************/
@@ -224,6 +1019,22 @@ static void _NEOM8X_reset_position(NEOM8X_position_t* gps_position) {
     (gps_position->long_east_flag) = 0;
     (gps_position->altitude) = 0;
 }
+
+/*******************************************************************/
+static void _NEOM8X_reset_position_e7(NEOM8X_position_e7_t* gps_position_e7) {
+    // Reset all fields to 0.
+    (gps_position_e7->latitude_e7) = 0;
+    (gps_position_e7->longitude_e7) = 0;
+    (gps_position_e7->altitude_mm) = 0;
+}
+
+/*******************************************************************/
+static void _NEOM8X_reset_fix_quality(NEOM8X_fix_quality_t* fix_quality) {
+    // Reset all fields.
+    (fix_quality->fix_indicator) = NEOM8X_FIX_INDICATOR_NONE;
+    (fix_quality->number_of_satellites) = 0;
+    (fix_quality->hdop) = NEOM8X_HDOP_MAX;
+}
 #endif
 
 #ifdef NEOM8X_DRIVER_GPS_DATA_TIME
@@ -253,6 +1064,39 @@ static void _NEOM8X_copy_position(NEOM8X_position_t* source, NEOM8X_position_t*
     (destination->long_east_flag) = (source->long_east_flag);
     (destination->altitude) = (source->altitude);
 }
+
+/*******************************************************************/
+static void _NEOM8X_copy_position_e7(NEOM8X_position_e7_t* source, NEOM8X_position_e7_t* destination) {
+    // Copy data.
+    (destination->latitude_e7) = (source->latitude_e7);
+    (destination->longitude_e7) = (source->longitude_e7);
+    (destination->altitude_mm) = (source->altitude_mm);
+}
+
+/*******************************************************************/
+static int32_t _NEOM8X_convert_coordinate_e7(uint8_t degrees, uint8_t minutes, uint32_t seconds, uint8_t positive_flag) {
+    // Local variables.
+    uint32_t minute_fractions = ((((uint32_t) minutes) * NEOM8X_MINUTE_FRACTIONS_PER_MINUTE) + seconds);
+    int32_t coordinate_e7 = 0;
+    // 10^-5 minute = (5 / 3) * 10^-7 degree (rounded).
+    coordinate_e7 = (int32_t) ((((uint32_t) degrees) * 10000000) + (((minute_fractions * 5) + 1) / 3));
+    return ((positive_flag != 0) ? coordinate_e7 : (-coordinate_e7));
+}
+
+/*******************************************************************/
+static void _NEOM8X_convert_position_e7(NEOM8X_position_t* gps_position, NEOM8X_position_e7_t* gps_position_e7) {
+    // Convert NMEA coordinates (the altitude is decoded separately to keep its fractional part).
+    (gps_position_e7->latitude_e7) = _NEOM8X_convert_coordinate_e7((gps_position->lat_degrees), (gps_position->lat_minutes), (gps_position->lat_seconds), (gps_position->lat_north_flag));
+    (gps_position_e7->longitude_e7) = _NEOM8X_convert_coordinate_e7((gps_position->long_degrees), (gps_position->long_minutes), (gps_position->long_seconds), (gps_position->long_east_flag));
+}
+
+/*******************************************************************/
+static void _NEOM8X_copy_fix_quality(NEOM8X_fix_quality_t* source, NEOM8X_fix_quality_t* destination) {
+    // Copy data.
+    (destination->fix_indicator) = (source->fix_indicator);
+    (destination->number_of_satellites) = (source->number_of_satellites);
+    (destination->hdop) = (source->hdop);
+}
 #endif
 
 #ifdef NEOM8X_DRIVER_GPS_DATA_TIME
@@ -270,6 +1114,9 @@ static uint8_t _NEOM8X_check_time(NEOM8X_time_t* gps_time) {
     {
         time_valid_flag = 1;
     }
+    else {
+        neom8x_ctx.statistics.data_validity_error_count++;
+    }
     return time_valid_flag;
 }
 #endif
@@ -285,6 +1132,9 @@ static uint8_t _NEOM8X_check_position(NEOM8X_position_t* gps_position) {
     {
         position_valid_flag = 1;
     }
+    else {
+        neom8x_ctx.statistics.data_validity_error_count++;
+    }
     return position_valid_flag;
 }
 #endif
@@ -297,8 +1147,7 @@ static void _NEOM8X_compute_ubx_checksum(uint8_t* ubx_command, uint8_t payload_l
     uint32_t idx = 0;
     // See algorithm on p.136 of NEO-M8 programming manual.
     for (idx = NEOM8X_UBX_CHECKSUM_OFFSET_BYTES; idx < ((uint32_t) (NEOM8X_UBX_CHECKSUM_OFFSET_BYTES + NEOM8X_UBX_CHECKSUM_OVERHEAD_SIZE_BYTES + payload_length)); idx++) {
-        ck_a = ck_a + ubx_command[idx];
-        ck_b = ck_b + ck_a;
+        _NEOM8X_update_ubx_checksum(ck_a, ck_b, ubx_command[idx]);
     }
     // Fill two last bytes of the UBX message with CK_A and CK_B.
     ubx_command[idx + 0] = ck_a;
@@ -306,160 +1155,85 @@ static void _NEOM8X_compute_ubx_checksum(uint8_t* ubx_command, uint8_t payload_l
 }
 
 /*******************************************************************/
-static void _NEOM8X_compute_nmea_checksum(char_t* nmea_rx_buf, uint8_t* ck, uint8_t* compute_success_flag) {
-    // Local variables.
-    uint8_t message_start_char_idx = 0;
-    uint8_t checksum_start_char_idx = 0;
-    uint8_t checksum_idx = 0;
-    // Reset value and flag.
-    (*ck) = 0;
-    (*compute_success_flag) = 0;
-    // Get message start index (see algorithm on p.105 of NEO-M8 programming manual).
-    while ((nmea_rx_buf[message_start_char_idx] != NEOM8X_NMEA_CHAR_MESSAGE_START) && (message_start_char_idx < NEOM8X_NMEA_RX_BUFFER_SIZE_BYTES)) {
-        message_start_char_idx++;
-    }
-    // Get checksum start index.
-    checksum_start_char_idx = message_start_char_idx;
-    while ((nmea_rx_buf[checksum_start_char_idx] != NEOM8X_NMEA_CHAR_CHECKSUM_START) && (checksum_start_char_idx < NEOM8X_NMEA_RX_BUFFER_SIZE_BYTES)) {
-        checksum_start_char_idx++;
-    }
-    if (checksum_start_char_idx >= NEOM8X_NMEA_RX_BUFFER_SIZE_BYTES) goto errors;
-    // Compute checksum.
-    for (checksum_idx = (message_start_char_idx + 1); checksum_idx < checksum_start_char_idx; checksum_idx++) {
-        // Exclusive OR of all characters between '$' and '*'.
-        (*ck) ^= (uint8_t) nmea_rx_buf[checksum_idx];
-    }
-    // Update output flag.
-    (*compute_success_flag) = 1;
-errors:
-    return;
-}
-
-/*******************************************************************/
-static void _NEOM8X_get_nmea_checksum(char_t* nmea_rx_buf, uint8_t* ck, uint8_t* get_success_flag) {
+static void _NEOM8X_scan_nmea_sentence(char_t* nmea_rx_buf, NEOM8X_nmea_sentence_t* nmea_sentence, uint8_t* scan_success_flag) {
     // Local variables.
-    STRING_status_t string_status = STRING_SUCCESS;
-    uint8_t checksum_start_char_idx = 0;
-    int32_t ck_value = 0;
-    // Reset value and flag.
-    (*ck) = 0;
-    (*get_success_flag) = 0;
-    // Get checksum start index (see NMEA messages format on p.105 of NEO-M8 programming manual).
-    while ((nmea_rx_buf[checksum_start_char_idx] != NEOM8X_NMEA_CHAR_CHECKSUM_START) && (checksum_start_char_idx < NEOM8X_NMEA_RX_BUFFER_SIZE_BYTES)) {
-        checksum_start_char_idx++;
+    uint8_t char_idx = 1;
+    char_t nmea_char = 0;
+    // Reset sentence and flag.
+    (nmea_sentence->buffer) = nmea_rx_buf;
+    (nmea_sentence->number_of_fields) = 0;
+    (nmea_sentence->field_offset)[0] = char_idx;
+    (*scan_success_flag) = 0;
+    // Build fields table in a single pass (the frame starts with '$' and its checksum has already been verified by the reception state machine).
+    while (char_idx < NEOM8X_RX_BUFFER_SIZE_BYTES) {
+        // Read character.
+        nmea_char = nmea_rx_buf[char_idx];
+        if (nmea_char == NEOM8X_NMEA_CHAR_CHECKSUM_START) break;
+        // Store field offset.
+        if (nmea_char == NEOM8X_NMEA_CHAR_SEPARATOR) {
+            (nmea_sentence->number_of_fields)++;
+            if ((nmea_sentence->number_of_fields) >= NEOM8X_NMEA_FIELD_NUMBER_MAX) goto errors;
+            (nmea_sentence->field_offset)[nmea_sentence->number_of_fields] = (uint8_t) (char_idx + 1);
+        }
+        char_idx++;
     }
-    if (checksum_start_char_idx >= NEOM8X_NMEA_RX_BUFFER_SIZE_BYTES) goto errors;
-    // Convert hexadecimal to value.
-    string_status = STRING_string_to_integer(&(nmea_rx_buf[checksum_start_char_idx + 1]), STRING_FORMAT_HEXADECIMAL, 2, &ck_value);
-    if (string_status != STRING_SUCCESS) goto errors;
-    // Cast to byte.
-    (*ck) = (uint8_t) ck_value;
+    if (char_idx >= NEOM8X_RX_BUFFER_SIZE_BYTES) goto errors;
+    // Close last field.
+    (nmea_sentence->number_of_fields)++;
+    (nmea_sentence->field_offset)[nmea_sentence->number_of_fields] = (uint8_t) (char_idx + 1);
     // Update output flag.
-    (*get_success_flag) = 1;
+    (*scan_success_flag) = 1;
 errors:
     return;
 }
 
 #ifdef NEOM8X_DRIVER_GPS_DATA_TIME
 /*******************************************************************/
-static void _NEOM8X_parse_nmea_zda(char_t* nmea_rx_buf, NEOM8X_time_t* gps_time, uint8_t* decode_success_flag) {
+static void _NEOM8X_parse_nmea_zda(NEOM8X_nmea_sentence_t* nmea_sentence, NEOM8X_time_t* gps_time, uint8_t* decode_success_flag) {
     // Local variables.
-    STRING_status_t string_status = STRING_SUCCESS;
-    uint8_t checksum_get_success_flag = 0;
-    uint8_t checksum_compute_success_flag = 0;
-    uint8_t received_checksum = 0;
-    uint8_t computed_checksum = 0;
-    uint8_t last_field_parsed = 0;
-    NEOM8X_nmea_zda_field_index_t field_idx = 0;
-    uint8_t char_idx = 0;
-    uint8_t separator_idx = 0;
-    int32_t value = 0;
+    char_t* field = NULL;
+    uint32_t value = 0;
     // Reset flag.
     (*decode_success_flag) = 0;
-    // Compute checksums.
-    _NEOM8X_get_nmea_checksum(nmea_rx_buf, &received_checksum, &checksum_get_success_flag);
-    _NEOM8X_compute_nmea_checksum(nmea_rx_buf, &computed_checksum, &checksum_compute_success_flag);
-    // Verify checksum.
-    if ((checksum_get_success_flag == 0) || (checksum_compute_success_flag == 0) || (computed_checksum != received_checksum)) goto errors;
-    // Search NMEA start character.
-    while ((nmea_rx_buf[separator_idx] != NEOM8X_NMEA_CHAR_MESSAGE_START) && (separator_idx < NEOM8X_NMEA_RX_BUFFER_SIZE_BYTES)) {
-        separator_idx++;
-        char_idx++;
-    }
-    // Extract NMEA data (see ZDA message format on p.127 of NEO-M8 programming manual).
-    while ((nmea_rx_buf[char_idx] != NEOM8X_NMEA_CHAR_END) && (char_idx < NEOM8X_NMEA_RX_BUFFER_SIZE_BYTES)) {
-        // Check if separator is found.
-        if (nmea_rx_buf[char_idx] == NEOM8X_NMEA_CHAR_SEPARATOR) {
-            // Get current field.
-            switch (field_idx) {
-            // Field 0 = address = <ID><message>.
-            case NEOM8X_NMEA_ZDA_FIELD_INDEX_MESSAGE:
-                // Check field length.
-                _NEOM8X_check_field_size(NEOM8X_NMEA_ZDA_FIELD_SIZE_MESSAGE);
-                // Check if message = 'ZDA'.
-                if ((nmea_rx_buf[separator_idx + 3] != 'Z') || (nmea_rx_buf[separator_idx + 4] != 'D') || (nmea_rx_buf[separator_idx + 5] != 'A')) goto errors;
-                break;
-            // Field 1 = time = hhmmss.ss.
-            case NEOM8X_NMEA_ZDA_FIELD_INDEX_TIME:
-                // Check field length.
-                _NEOM8X_check_field_size(NEOM8X_NMEA_ZDA_FIELD_SIZE_TIME);
-                // Parse hours.
-                string_status = STRING_string_to_integer(&(nmea_rx_buf[separator_idx + 1]), STRING_FORMAT_DECIMAL, 2, &value);
-                _NEOM8X_check_string_status();
-                gps_time->hours = (uint8_t) value;
-                // Parse minutes.
-                string_status = STRING_string_to_integer(&(nmea_rx_buf[separator_idx + 3]), STRING_FORMAT_DECIMAL, 2, &value);
-                _NEOM8X_check_string_status();
-                gps_time->minutes = (uint8_t) value;
-                // Parse seconds.
-                string_status = STRING_string_to_integer(&(nmea_rx_buf[separator_idx + 5]), STRING_FORMAT_DECIMAL, 2, &value);
-                _NEOM8X_check_string_status();
-                gps_time->seconds = (uint8_t) value;
-                break;
-            // Field 2 = day = dd.
-            case NEOM8X_NMEA_ZDA_FIELD_INDEX_DAY:
-                // Check field length.
-                _NEOM8X_check_field_size(NEOM8X_NMEA_ZDA_FIELD_SIZE_DAY);
-                // Parse day.
-                string_status = STRING_string_to_integer(&(nmea_rx_buf[separator_idx + 1]), STRING_FORMAT_DECIMAL, 2, &value);
-                _NEOM8X_check_string_status();
-                gps_time->date = (uint8_t) value;
-                break;
-            // Field 3 = month = mm.
-            case NEOM8X_NMEA_ZDA_FIELD_INDEX_MONTH:
-                // Check field length.
-                _NEOM8X_check_field_size(NEOM8X_NMEA_ZDA_FIELD_SIZE_MONTH);
-                // Parse month.
-                string_status = STRING_string_to_integer(&(nmea_rx_buf[separator_idx + 1]), STRING_FORMAT_DECIMAL, 2, &value);
-                _NEOM8X_check_string_status();
-                gps_time->month = (uint8_t) value;
-                break;
-            // Field 4 = year = yyyy.
-            case NEOM8X_NMEA_ZDA_FIELD_INDEX_YEAR:
-                // Check field length.
-                _NEOM8X_check_field_size(NEOM8X_NMEA_ZDA_FIELD_SIZE_YEAR);
-                // Parse year.
-                string_status = STRING_string_to_integer(&(nmea_rx_buf[separator_idx + 1]), STRING_FORMAT_DECIMAL, 4, &value);
-                _NEOM8X_check_string_status();
-                gps_time->year = (uint16_t) value;
-                // Update local flag.
-                last_field_parsed = 1;
-                break;
-            // Unused or unknown fields.
-            default:
-                break;
-            }
-            // Increment field index and update separator.
-            field_idx++;
-            separator_idx = char_idx;
-        }
-        // Increment character index.
-        char_idx++;
-    }
-    if (last_field_parsed != 0) {
-        // Check if time is valid.
-        (*decode_success_flag) = _NEOM8X_check_time(gps_time);
-    }
+    // Check number of fields (see ZDA message format on p.127 of NEO-M8 programming manual).
+    if ((nmea_sentence->number_of_fields) <= NEOM8X_NMEA_ZDA_FIELD_INDEX_YEAR) goto errors;
+    // Field 0 = address = <ID><message>.
+    _NEOM8X_check_field_size(NEOM8X_NMEA_ZDA_FIELD_INDEX_MESSAGE, NEOM8X_NMEA_ZDA_FIELD_SIZE_MESSAGE);
+    field = _NEOM8X_get_field(NEOM8X_NMEA_ZDA_FIELD_INDEX_MESSAGE);
+    // Check if message = 'ZDA'.
+    if ((field[2] != 'Z') || (field[3] != 'D') || (field[4] != 'A')) goto errors;
+    // Field 1 = time = hhmmss.ss.
+    _NEOM8X_check_field_size(NEOM8X_NMEA_ZDA_FIELD_INDEX_TIME, NEOM8X_NMEA_ZDA_FIELD_SIZE_TIME);
+    field = _NEOM8X_get_field(NEOM8X_NMEA_ZDA_FIELD_INDEX_TIME);
+    // Parse hours.
+    _NEOM8X_decode_decimal_field(&(field[0]), 2, &value);
+    gps_time->hours = (uint8_t) value;
+    // Parse minutes.
+    _NEOM8X_decode_decimal_field(&(field[2]), 2, &value);
+    gps_time->minutes = (uint8_t) value;
+    // Parse seconds.
+    _NEOM8X_decode_decimal_field(&(field[4]), 2, &value);
+    gps_time->seconds = (uint8_t) value;
+    // Field 2 = day = dd.
+    _NEOM8X_check_field_size(NEOM8X_NMEA_ZDA_FIELD_INDEX_DAY, NEOM8X_NMEA_ZDA_FIELD_SIZE_DAY);
+    field = _NEOM8X_get_field(NEOM8X_NMEA_ZDA_FIELD_INDEX_DAY);
+    // Parse day.
+    _NEOM8X_decode_decimal_field(&(field[0]), 2, &value);
+    gps_time->date = (uint8_t) value;
+    // Field 3 = month = mm.
+    _NEOM8X_check_field_size(NEOM8X_NMEA_ZDA_FIELD_INDEX_MONTH, NEOM8X_NMEA_ZDA_FIELD_SIZE_MONTH);
+    field = _NEOM8X_get_field(NEOM8X_NMEA_ZDA_FIELD_INDEX_MONTH);
+    // Parse month.
+    _NEOM8X_decode_decimal_field(&(field[0]), 2, &value);
+    gps_time->month = (uint8_t) value;
+    // Field 4 = year = yyyy.
+    _NEOM8X_check_field_size(NEOM8X_NMEA_ZDA_FIELD_INDEX_YEAR, NEOM8X_NMEA_ZDA_FIELD_SIZE_YEAR);
+    field = _NEOM8X_get_field(NEOM8X_NMEA_ZDA_FIELD_INDEX_YEAR);
+    // Parse year.
+    _NEOM8X_decode_decimal_field(&(field[0]), 4, &value);
+    gps_time->year = (uint16_t) value;
+    // Check if time is valid.
+    (*decode_success_flag) = _NEOM8X_check_time(gps_time);
 errors:
     return;
 }
@@ -467,447 +1241,2439 @@ errors:
 
 #ifdef NEOM8X_DRIVER_GPS_DATA_POSITION
 /*******************************************************************/
-static void _NEOM8X_parse_nmea_gga(char_t* nmea_rx_buf, NEOM8X_position_t* gps_position, uint8_t* decode_success_flag) {
+static void _NEOM8X_parse_nmea_gga(NEOM8X_nmea_sentence_t* nmea_sentence, NEOM8X_position_t* gps_position, NEOM8X_position_e7_t* gps_position_e7, NEOM8X_fix_quality_t* fix_quality, uint8_t* decode_success_flag) {
     // Local variables
-    STRING_status_t string_status = STRING_SUCCESS;
-    uint8_t checksum_get_success_flag = 0;
-    uint8_t checksum_compute_success_flag = 0;
-    uint8_t received_checksum = 0;
-    uint8_t computed_checksum = 0;
-    uint8_t last_field_parsed = 0;
-    NMEA_gga_field_index_t field_idx = 0;
-    uint8_t char_idx = 0;
-    uint8_t separator_idx = 0;
+    char_t* field = NULL;
+    uint8_t field_size = 0;
     uint8_t alt_field_size = 0;
     uint8_t alt_number_of_digits = 0;
-    int32_t value = 0;
+    uint8_t alt_sign_size = 0;
+    uint8_t alt_fraction_size = 0;
+    int32_t altitude_mm = 0;
+    uint8_t hdop_number_of_digits = 0;
+    uint32_t value = 0;
     // Reset flag.
     (*decode_success_flag) = 0;
-    // Compute checksums.
-    _NEOM8X_get_nmea_checksum(nmea_rx_buf, &received_checksum, &checksum_get_success_flag);
-    _NEOM8X_compute_nmea_checksum(nmea_rx_buf, &computed_checksum, &checksum_compute_success_flag);
-    // Verify checksum.
-    if ((checksum_get_success_flag == 0) || (checksum_compute_success_flag == 0) || (computed_checksum != received_checksum)) goto errors;
-    // Search NMEA start character.
-    while ((nmea_rx_buf[separator_idx] != NEOM8X_NMEA_CHAR_MESSAGE_START) && (separator_idx < NEOM8X_NMEA_RX_BUFFER_SIZE_BYTES)) {
-        separator_idx++;
-        char_idx++;
+    // Check number of fields (see GGA message format on p.114 of NEO-M8 programming manual).
+    if ((nmea_sentence->number_of_fields) <= NEOM8X_NMEA_GGA_FIELD_INDEX_U_ALT) goto errors;
+    // Field 0 = address = <ID><message>.
+    _NEOM8X_check_field_size(NEOM8X_NMEA_GGA_FIELD_INDEX_MESSAGE, NEOM8X_NMEA_GGA_FIELD_SIZE_MESSAGE);
+    field = _NEOM8X_get_field(NEOM8X_NMEA_GGA_FIELD_INDEX_MESSAGE);
+    // Check if message = 'GGA'.
+    if ((field[2] != 'G') || (field[3] != 'G') || (field[4] != 'A')) goto errors;
+    // Field 6 = fix quality indicator (parsed first since coordinates are empty without fix).
+    _NEOM8X_reset_fix_quality(fix_quality);
+    _NEOM8X_check_field_size(NEOM8X_NMEA_GGA_FIELD_INDEX_QUALITY, NEOM8X_NMEA_GGA_FIELD_SIZE_QUALITY);
+    field = _NEOM8X_get_field(NEOM8X_NMEA_GGA_FIELD_INDEX_QUALITY);
+    switch (field[0]) {
+    case NEOM8X_NMEA_GGA_QUALITY_NO_FIX:
+        // Report the indicator alone, the fix is rejected by the quality gates.
+        (*decode_success_flag) = 1;
+        goto errors;
+    case NEOM8X_NMEA_GGA_QUALITY_AUTONOMOUS:
+        fix_quality->fix_indicator = NEOM8X_FIX_INDICATOR_AUTONOMOUS;
+        break;
+    case NEOM8X_NMEA_GGA_QUALITY_DIFFERENTIAL:
+        fix_quality->fix_indicator = NEOM8X_FIX_INDICATOR_DIFFERENTIAL;
+        break;
+    case NEOM8X_NMEA_GGA_QUALITY_RTK_FIXED:
+        fix_quality->fix_indicator = NEOM8X_FIX_INDICATOR_RTK_FIXED;
+        break;
+    case NEOM8X_NMEA_GGA_QUALITY_RTK_FLOAT:
+        fix_quality->fix_indicator = NEOM8X_FIX_INDICATOR_RTK_FLOAT;
+        break;
+    case NEOM8X_NMEA_GGA_QUALITY_DEAD_RECKONING:
+        fix_quality->fix_indicator = NEOM8X_FIX_INDICATOR_DEAD_RECKONING;
+        break;
+    case NEOM8X_NMEA_GGA_QUALITY_MANUAL:
+        fix_quality->fix_indicator = NEOM8X_FIX_INDICATOR_MANUAL;
+        break;
+    case NEOM8X_NMEA_GGA_QUALITY_SIMULATOR:
+        fix_quality->fix_indicator = NEOM8X_FIX_INDICATOR_SIMULATOR;
+        break;
+    default:
+        goto errors;
     }
-    // Extract NMEA data (see GGA message format on p.114 of NEO-M8 programming manual).
-    while ((nmea_rx_buf[char_idx] != NEOM8X_NMEA_CHAR_END) && (char_idx < NEOM8X_NMEA_RX_BUFFER_SIZE_BYTES)) {
-        // Check if separator is found.
-        if (nmea_rx_buf[char_idx] == NEOM8X_NMEA_CHAR_SEPARATOR) {
-            // Get current field.
-            switch (field_idx) {
-            // Field 0 = address = <ID><message>.
-            case NEOM8X_NMEA_GGA_FIELD_INDEX_MESSAGE:
-                // Check field length.
-                _NEOM8X_check_field_size(NEOM8X_NMEA_GGA_FIELD_SIZE_MESSAGE);
-                // Check if message = 'GGA'.
-                if ((nmea_rx_buf[separator_idx + 3] != 'G') || (nmea_rx_buf[separator_idx + 4] != 'G') || (nmea_rx_buf[separator_idx + 5] != 'A')) goto errors;
-                break;
-            // Field 2 = latitude = ddmm.mmmmm.
-            case NEOM8X_NMEA_GGA_FIELD_INDEX_LAT:
-                // Check field length.
-                _NEOM8X_check_field_size(NEOM8X_NMEA_GGA_FIELD_SIZE_LAT);
-                // Parse degrees.
-                string_status = STRING_string_to_integer(&(nmea_rx_buf[separator_idx + 1]), STRING_FORMAT_DECIMAL, 2, &value);
-                _NEOM8X_check_string_status();
-                gps_position->lat_degrees = (uint8_t) value;
-                // Parse minutes.
-                string_status = STRING_string_to_integer(&(nmea_rx_buf[separator_idx + 3]), STRING_FORMAT_DECIMAL, 2, &value);
-                _NEOM8X_check_string_status();
-                gps_position->lat_minutes = (uint8_t) value;
-                // Parse seconds.
-                string_status = STRING_string_to_integer(&(nmea_rx_buf[separator_idx + 6]), STRING_FORMAT_DECIMAL, 5, &value);
-                _NEOM8X_check_string_status();
-                gps_position->lat_seconds = (uint32_t) value;
-                break;
-            // Field 3 = N or S.
-            case NEOM8X_NMEA_GGA_FIELD_INDEX_NS:
-                // Check field length.
-                _NEOM8X_check_field_size(NEOM8X_NMEA_GGA_FIELD_SIZE_NS);
-                // Parse north flag.
-                switch (nmea_rx_buf[separator_idx + 1]) {
-                case NEOM8X_NMEA_GGA_NORTH:
-                    (*gps_position).lat_north_flag = 1;
-                    break;
-                case NEOM8X_NMEA_GGA_SOUTH:
-                    (*gps_position).lat_north_flag = 0;
-                    break;
-                default:
-                    goto errors;
-                }
-                break;
-            // Field 4 = longitude = dddmm.mmmmm.
-            case NEOM8X_NMEA_GGA_FIELD_INDEX_LONG:
-                // Check field length.
-                _NEOM8X_check_field_size(NEOM8X_NMEA_GGA_FIELD_SIZE_LONG);
-                // Parse degrees.
-                string_status = STRING_string_to_integer(&(nmea_rx_buf[separator_idx + 1]), STRING_FORMAT_DECIMAL, 3, &value);
-                _NEOM8X_check_string_status();
-                gps_position->long_degrees = (uint8_t) value;
-                // Parse minutes.
-                string_status = STRING_string_to_integer(&(nmea_rx_buf[separator_idx + 4]), STRING_FORMAT_DECIMAL, 2, &value);
-                _NEOM8X_check_string_status();
-                gps_position->long_minutes = (uint8_t) value;
-                // Parse seconds.
-                string_status = STRING_string_to_integer(&(nmea_rx_buf[separator_idx + 7]), STRING_FORMAT_DECIMAL, 5, &value);
-                _NEOM8X_check_string_status();
-                gps_position->long_seconds = (uint32_t) value;
-                break;
-            // Field 5 = E or W.
-            case NEOM8X_NMEA_GGA_FIELD_INDEX_EW:
-                // Check field length.
-                _NEOM8X_check_field_size(NEOM8X_NMEA_GGA_FIELD_SIZE_EW);
-                // Parse east flag.
-                switch (nmea_rx_buf[separator_idx + 1]) {
-                case NEOM8X_NMEA_GGA_EAST:
-                    (*gps_position).long_east_flag = 1;
-                    break;
-                case NEOM8X_NMEA_GGA_WEST:
-                    (*gps_position).long_east_flag = 0;
-                    break;
-                default:
-                    goto errors;
-                }
-                break;
-            // Field 9 = altitude.
-            case NEOM8X_NMEA_GGA_FIELD_INDEX_ALT:
-                // Get field length.
-                alt_field_size = (uint8_t) ((char_idx - separator_idx) - 1);
-                // Check field length.
-                if (alt_field_size == 0) goto errors;
-                // Get number of digits of integer part (search dot).
-                for (alt_number_of_digits = 0; alt_number_of_digits < alt_field_size; alt_number_of_digits++) {
-                    if (nmea_rx_buf[separator_idx + 1 + alt_number_of_digits] == STRING_CHAR_DOT) {
-                        break; // Dot found, stop counting integer part length.
-                    }
-                }
-                // Compute integer part.
-                string_status = STRING_string_to_integer(&(nmea_rx_buf[separator_idx + 1]), STRING_FORMAT_DECIMAL, alt_number_of_digits, &value);
-                _NEOM8X_check_string_status();
-                gps_position->altitude = (uint32_t) value;
-                // Rounding operation if fractional part exists.
-                if ((char_idx - (separator_idx + alt_number_of_digits) - 1) >= 2) {
-                    // Convert tenth part.
-                    string_status = STRING_string_to_integer(&(nmea_rx_buf[separator_idx + alt_number_of_digits + 2]), STRING_FORMAT_DECIMAL, 1, &value);
-                    _NEOM8X_check_string_status();
-                    if (value >= 5) {
-                        (*gps_position).altitude++;
-                    }
-                }
-                break;
-            // Field 10 = altitude unit.
-            case NEOM8X_NMEA_GGA_FIELD_INDEX_U_ALT:
-                // Check field length.
-                _NEOM8X_check_field_size(NEOM8X_NMEA_GGA_FIELD_SIZE_U_ALT);
-                // Parse altitude unit.
-                if (nmea_rx_buf[separator_idx + 1] != NEOM8X_NMEA_GGA_METERS) goto errors;
-                // Update local flag.
-                last_field_parsed = 1;
-                break;
-                // Unused or unknown fields.
-            default:
-                break;
-            }
-            // Increment field index and update separator.
-            field_idx++;
-            separator_idx = char_idx;
-        }
-        // Increment character index.
-        char_idx++;
+    // Field 2 = latitude = ddmm.mmmmm.
+    _NEOM8X_check_field_size(NEOM8X_NMEA_GGA_FIELD_INDEX_LAT, NEOM8X_NMEA_GGA_FIELD_SIZE_LAT);
+    field = _NEOM8X_get_field(NEOM8X_NMEA_GGA_FIELD_INDEX_LAT);
+    // Parse degrees.
+    _NEOM8X_decode_decimal_field(&(field[0]), 2, &value);
+    gps_position->lat_degrees = (uint8_t) value;
+    // Parse minutes.
+    _NEOM8X_decode_decimal_field(&(field[2]), 2, &value);
+    gps_position->lat_minutes = (uint8_t) value;
+    // Parse seconds.
+    _NEOM8X_decode_decimal_field(&(field[5]), 5, &value);
+    gps_position->lat_seconds = (uint32_t) value;
+    // Field 3 = N or S.
+    _NEOM8X_check_field_size(NEOM8X_NMEA_GGA_FIELD_INDEX_NS, NEOM8X_NMEA_GGA_FIELD_SIZE_NS);
+    field = _NEOM8X_get_field(NEOM8X_NMEA_GGA_FIELD_INDEX_NS);
+    // Parse north flag.
+    switch (field[0]) {
+    case NEOM8X_NMEA_GGA_NORTH:
+        (*gps_position).lat_north_flag = 1;
+        break;
+    case NEOM8X_NMEA_GGA_SOUTH:
+        (*gps_position).lat_north_flag = 0;
+        break;
+    default:
+        goto errors;
     }
-    if (last_field_parsed != 0) {
-        // Check if time is valid.
-        (*decode_success_flag) = _NEOM8X_check_position(gps_position);
+    // Field 4 = longitude = dddmm.mmmmm.
+    _NEOM8X_check_field_size(NEOM8X_NMEA_GGA_FIELD_INDEX_LONG, NEOM8X_NMEA_GGA_FIELD_SIZE_LONG);
+    field = _NEOM8X_get_field(NEOM8X_NMEA_GGA_FIELD_INDEX_LONG);
+    // Parse degrees.
+    _NEOM8X_decode_decimal_field(&(field[0]), 3, &value);
+    gps_position->long_degrees = (uint8_t) value;
+    // Parse minutes.
+    _NEOM8X_decode_decimal_field(&(field[3]), 2, &value);
+    gps_position->long_minutes = (uint8_t) value;
+    // Parse seconds.
+    _NEOM8X_decode_decimal_field(&(field[6]), 5, &value);
+    gps_position->long_seconds = (uint32_t) value;
+    // Field 5 = E or W.
+    _NEOM8X_check_field_size(NEOM8X_NMEA_GGA_FIELD_INDEX_EW, NEOM8X_NMEA_GGA_FIELD_SIZE_EW);
+    field = _NEOM8X_get_field(NEOM8X_NMEA_GGA_FIELD_INDEX_EW);
+    // Parse east flag.
+    switch (field[0]) {
+    case NEOM8X_NMEA_GGA_EAST:
+        (*gps_position).long_east_flag = 1;
+        break;
+    case NEOM8X_NMEA_GGA_WEST:
+        (*gps_position).long_east_flag = 0;
+        break;
+    default:
+        goto errors;
+    }
+    // Field 7 = number of satellites used.
+    field_size = _NEOM8X_get_field_size(NEOM8X_NMEA_GGA_FIELD_INDEX_NUMSV);
+    field = _NEOM8X_get_field(NEOM8X_NMEA_GGA_FIELD_INDEX_NUMSV);
+    if ((field_size == 0) || (field_size > 2)) {
+        neom8x_ctx.statistics.field_size_error_count++;
+        goto errors;
+    }
+    _NEOM8X_decode_decimal_field(&(field[0]), field_size, &value);
+    fix_quality->number_of_satellites = (uint8_t) value;
+    // Field 8 = horizontal dilution of precision = x.xx.
+    field_size = _NEOM8X_get_field_size(NEOM8X_NMEA_GGA_FIELD_INDEX_HDOP);
+    field = _NEOM8X_get_field(NEOM8X_NMEA_GGA_FIELD_INDEX_HDOP);
+    for (hdop_number_of_digits = 0; hdop_number_of_digits < field_size; hdop_number_of_digits++) {
+        if (field[hdop_number_of_digits] == STRING_CHAR_DOT) break;
+    }
+    if ((hdop_number_of_digits == 0) || (hdop_number_of_digits > 2) || ((field_size - hdop_number_of_digits) < 2)) {
+        neom8x_ctx.statistics.field_size_error_count++;
+        goto errors;
+    }
+    // Convert to tenths (truncated).
+    _NEOM8X_decode_decimal_field(&(field[0]), hdop_number_of_digits, &value);
+    fix_quality->hdop = (uint8_t) ((value >= (NEOM8X_HDOP_MAX / 10)) ? NEOM8X_HDOP_MAX : (value * 10));
+    _NEOM8X_decode_decimal_field(&(field[hdop_number_of_digits + 1]), 1, &value);
+    if (fix_quality->hdop < NEOM8X_HDOP_MAX) {
+        fix_quality->hdop = (uint8_t) (fix_quality->hdop + value);
+    }
+    // Field 9 = altitude.
+    alt_field_size = _NEOM8X_get_field_size(NEOM8X_NMEA_GGA_FIELD_INDEX_ALT);
+    field = _NEOM8X_get_field(NEOM8X_NMEA_GGA_FIELD_INDEX_ALT);
+    // Check field length.
+    if (alt_field_size == 0) {
+        neom8x_ctx.statistics.field_size_error_count++;
+        goto errors;
+    }
+    // Get number of digits of integer part (search dot).
+    for (alt_number_of_digits = 0; alt_number_of_digits < alt_field_size; alt_number_of_digits++) {
+        if (field[alt_number_of_digits] == STRING_CHAR_DOT) {
+            break; // Dot found, stop counting integer part length.
+        }
+    }
+    // Compute integer part.
+    alt_sign_size = (field[0] == NEOM8X_NMEA_CHAR_MINUS) ? 1 : 0;
+    _NEOM8X_decode_decimal_field(&(field[alt_sign_size]), (uint8_t) (alt_number_of_digits - alt_sign_size), &value);
+    altitude_mm = (int32_t) (value * 1000);
+    // Add fractional part with millimeter resolution.
+    if ((alt_field_size - alt_number_of_digits) >= 2) {
+        alt_fraction_size = (uint8_t) (alt_field_size - alt_number_of_digits - 1);
+        if (alt_fraction_size > 3) {
+            alt_fraction_size = 3;
+        }
+        _NEOM8X_decode_decimal_field(&(field[alt_number_of_digits + 1]), alt_fraction_size, &value);
+        for (; alt_fraction_size < 3; alt_fraction_size++) {
+            value *= 10;
+        }
+        altitude_mm += (int32_t) value;
+    }
+    if (alt_sign_size != 0) {
+        altitude_mm = (-altitude_mm);
+    }
+    gps_position_e7->altitude_mm = altitude_mm;
+    // Altitude is unsigned: clamp to zero and round to the nearest meter.
+    gps_position->altitude = (altitude_mm > 0) ? ((uint32_t) ((altitude_mm + 500) / 1000)) : 0;
+    // Field 10 = altitude unit.
+    _NEOM8X_check_field_size(NEOM8X_NMEA_GGA_FIELD_INDEX_U_ALT, NEOM8X_NMEA_GGA_FIELD_SIZE_U_ALT);
+    field = _NEOM8X_get_field(NEOM8X_NMEA_GGA_FIELD_INDEX_U_ALT);
+    // Parse altitude unit.
+    if (field[0] != NEOM8X_NMEA_GGA_METERS) goto errors;
+    // Convert coordinates to fixed-point format.
+    _NEOM8X_convert_position_e7(gps_position, gps_position_e7);
+    // Check if position is valid.
+    (*decode_success_flag) = _NEOM8X_check_position(gps_position);
+errors:
+    return;
+}
+#endif
+
+#if ((defined NEOM8X_DRIVER_GPS_DATA_TIME) || (defined NEOM8X_DRIVER_GPS_DATA_POSITION))
+/*******************************************************************/
+static uint8_t _NEOM8X_check_nmea_rmc_status(NEOM8X_nmea_sentence_t* nmea_sentence, uint8_t field_index_max) {
+    // Local variables.
+    char_t* field = NULL;
+    uint8_t valid_flag = 0;
+    // Check number of fields (see RMC message format on p.120 of NEO-M8 programming manual).
+    if ((nmea_sentence->number_of_fields) <= field_index_max) goto errors;
+    // Field 0 = address = <ID><message>.
+    _NEOM8X_check_field_size(NEOM8X_NMEA_RMC_FIELD_INDEX_MESSAGE, NEOM8X_NMEA_RMC_FIELD_SIZE_MESSAGE);
+    field = _NEOM8X_get_field(NEOM8X_NMEA_RMC_FIELD_INDEX_MESSAGE);
+    // Check if message = 'RMC'.
+    if ((field[2] != 'R') || (field[3] != 'M') || (field[4] != 'C')) goto errors;
+    // Field 2 = status.
+    _NEOM8X_check_field_size(NEOM8X_NMEA_RMC_FIELD_INDEX_STATUS, NEOM8X_NMEA_RMC_FIELD_SIZE_STATUS);
+    field = _NEOM8X_get_field(NEOM8X_NMEA_RMC_FIELD_INDEX_STATUS);
+    // Data is valid only if status = 'A'.
+    if (field[0] != NEOM8X_NMEA_RMC_STATUS_VALID) goto errors;
+    valid_flag = 1;
+errors:
+    return valid_flag;
+}
+#endif
+
+#ifdef NEOM8X_DRIVER_GPS_DATA_TIME
+/*******************************************************************/
+static void _NEOM8X_parse_nmea_rmc_time(NEOM8X_nmea_sentence_t* nmea_sentence, NEOM8X_time_t* gps_time, uint8_t* decode_success_flag) {
+    // Local variables.
+    char_t* field = NULL;
+    uint32_t value = 0;
+    // Reset flag.
+    (*decode_success_flag) = 0;
+    // Check message and status.
+    if (_NEOM8X_check_nmea_rmc_status(nmea_sentence, NEOM8X_NMEA_RMC_FIELD_INDEX_DATE) == 0) goto errors;
+    // Field 1 = time = hhmmss.ss.
+    _NEOM8X_check_field_size(NEOM8X_NMEA_RMC_FIELD_INDEX_TIME, NEOM8X_NMEA_RMC_FIELD_SIZE_TIME);
+    field = _NEOM8X_get_field(NEOM8X_NMEA_RMC_FIELD_INDEX_TIME);
+    // Parse hours.
+    _NEOM8X_decode_decimal_field(&(field[0]), 2, &value);
+    gps_time->hours = (uint8_t) value;
+    // Parse minutes.
+    _NEOM8X_decode_decimal_field(&(field[2]), 2, &value);
+    gps_time->minutes = (uint8_t) value;
+    // Parse seconds.
+    _NEOM8X_decode_decimal_field(&(field[4]), 2, &value);
+    gps_time->seconds = (uint8_t) value;
+    // Field 9 = date = ddmmyy.
+    _NEOM8X_check_field_size(NEOM8X_NMEA_RMC_FIELD_INDEX_DATE, NEOM8X_NMEA_RMC_FIELD_SIZE_DATE);
+    field = _NEOM8X_get_field(NEOM8X_NMEA_RMC_FIELD_INDEX_DATE);
+    // Parse day.
+    _NEOM8X_decode_decimal_field(&(field[0]), 2, &value);
+    gps_time->date = (uint8_t) value;
+    // Parse month.
+    _NEOM8X_decode_decimal_field(&(field[2]), 2, &value);
+    gps_time->month = (uint8_t) value;
+    // Parse year.
+    _NEOM8X_decode_decimal_field(&(field[4]), 2, &value);
+    gps_time->year = (uint16_t) (NEOM8X_NMEA_RMC_CENTURY + value);
+    // Check if time is valid.
+    (*decode_success_flag) = _NEOM8X_check_time(gps_time);
+errors:
+    return;
+}
+#endif
+
+#ifdef NEOM8X_DRIVER_GPS_DATA_POSITION
+/*******************************************************************/
+static void _NEOM8X_parse_nmea_rmc_position(NEOM8X_nmea_sentence_t* nmea_sentence, NEOM8X_position_t* gps_position, uint8_t* decode_success_flag) {
+    // Local variables.
+    char_t* field = NULL;
+    uint32_t value = 0;
+    // Reset flag.
+    (*decode_success_flag) = 0;
+    // Check message and status.
+    if (_NEOM8X_check_nmea_rmc_status(nmea_sentence, NEOM8X_NMEA_RMC_FIELD_INDEX_EW) == 0) goto errors;
+    // Field 3 = latitude = ddmm.mmmmm.
+    _NEOM8X_check_field_size(NEOM8X_NMEA_RMC_FIELD_INDEX_LAT, NEOM8X_NMEA_RMC_FIELD_SIZE_LAT);
+    field = _NEOM8X_get_field(NEOM8X_NMEA_RMC_FIELD_INDEX_LAT);
+    // Parse degrees.
+    _NEOM8X_decode_decimal_field(&(field[0]), 2, &value);
+    gps_position->lat_degrees = (uint8_t) value;
+    // Parse minutes.
+    _NEOM8X_decode_decimal_field(&(field[2]), 2, &value);
+    gps_position->lat_minutes = (uint8_t) value;
+    // Parse seconds.
+    _NEOM8X_decode_decimal_field(&(field[5]), 5, &value);
+    gps_position->lat_seconds = (uint32_t) value;
+    // Field 4 = N or S.
+    _NEOM8X_check_field_size(NEOM8X_NMEA_RMC_FIELD_INDEX_NS, NEOM8X_NMEA_RMC_FIELD_SIZE_NS);
+    field = _NEOM8X_get_field(NEOM8X_NMEA_RMC_FIELD_INDEX_NS);
+    // Parse north flag.
+    switch (field[0]) {
+    case NEOM8X_NMEA_GGA_NORTH:
+        (*gps_position).lat_north_flag = 1;
+        break;
+    case NEOM8X_NMEA_GGA_SOUTH:
+        (*gps_position).lat_north_flag = 0;
+        break;
+    default:
+        goto errors;
+    }
+    // Field 5 = longitude = dddmm.mmmmm.
+    _NEOM8X_check_field_size(NEOM8X_NMEA_RMC_FIELD_INDEX_LONG, NEOM8X_NMEA_RMC_FIELD_SIZE_LONG);
+    field = _NEOM8X_get_field(NEOM8X_NMEA_RMC_FIELD_INDEX_LONG);
+    // Parse degrees.
+    _NEOM8X_decode_decimal_field(&(field[0]), 3, &value);
+    gps_position->long_degrees = (uint8_t) value;
+    // Parse minutes.
+    _NEOM8X_decode_decimal_field(&(field[3]), 2, &value);
+    gps_position->long_minutes = (uint8_t) value;
+    // Parse seconds.
+    _NEOM8X_decode_decimal_field(&(field[6]), 5, &value);
+    gps_position->long_seconds = (uint32_t) value;
+    // Field 6 = E or W.
+    _NEOM8X_check_field_size(NEOM8X_NMEA_RMC_FIELD_INDEX_EW, NEOM8X_NMEA_RMC_FIELD_SIZE_EW);
+    field = _NEOM8X_get_field(NEOM8X_NMEA_RMC_FIELD_INDEX_EW);
+    // Parse east flag.
+    switch (field[0]) {
+    case NEOM8X_NMEA_GGA_EAST:
+        (*gps_position).long_east_flag = 1;
+        break;
+    case NEOM8X_NMEA_GGA_WEST:
+        (*gps_position).long_east_flag = 0;
+        break;
+    default:
+        goto errors;
+    }
+    // Altitude is not provided by RMC message.
+    gps_position->altitude = 0;
+    // Check if position is valid.
+    (*decode_success_flag) = _NEOM8X_check_position(gps_position);
+errors:
+    return;
+}
+#endif
+
+#ifdef NEOM8X_DRIVER_GPS_DATA_POSITION
+/*******************************************************************/
+static void _NEOM8X_parse_nmea_rmc_fix_quality(NEOM8X_nmea_sentence_t* nmea_sentence, NEOM8X_fix_quality_t* fix_quality) {
+    // Local variables.
+    char_t* field = NULL;
+    // Satellites and HDOP are not provided by RMC message.
+    _NEOM8X_reset_fix_quality(fix_quality);
+    // Position mode field is only present from NMEA 2.3 (valid status is an autonomous fix otherwise).
+    fix_quality->fix_indicator = NEOM8X_FIX_INDICATOR_AUTONOMOUS;
+    if ((nmea_sentence->number_of_fields) <= NEOM8X_NMEA_RMC_FIELD_INDEX_POS_MODE) goto errors;
+    if (_NEOM8X_get_field_size(NEOM8X_NMEA_RMC_FIELD_INDEX_POS_MODE) != 1) goto errors;
+    // Field 12 = position mode.
+    field = _NEOM8X_get_field(NEOM8X_NMEA_RMC_FIELD_INDEX_POS_MODE);
+    switch (field[0]) {
+    case NEOM8X_NMEA_RMC_POS_MODE_DIFFERENTIAL:
+        fix_quality->fix_indicator = NEOM8X_FIX_INDICATOR_DIFFERENTIAL;
+        break;
+    case NEOM8X_NMEA_RMC_POS_MODE_RTK_FIXED:
+        fix_quality->fix_indicator = NEOM8X_FIX_INDICATOR_RTK_FIXED;
+        break;
+    case NEOM8X_NMEA_RMC_POS_MODE_RTK_FLOAT:
+        fix_quality->fix_indicator = NEOM8X_FIX_INDICATOR_RTK_FLOAT;
+        break;
+    case NEOM8X_NMEA_RMC_POS_MODE_DEAD_RECKONING:
+        fix_quality->fix_indicator = NEOM8X_FIX_INDICATOR_DEAD_RECKONING;
+        break;
+    case NEOM8X_NMEA_RMC_POS_MODE_MANUAL:
+        fix_quality->fix_indicator = NEOM8X_FIX_INDICATOR_MANUAL;
+        break;
+    case NEOM8X_NMEA_RMC_POS_MODE_SIMULATOR:
+        fix_quality->fix_indicator = NEOM8X_FIX_INDICATOR_SIMULATOR;
+        break;
+    default:
+        break;
+    }
+errors:
+    return;
+}
+#endif
+
+#if ((defined NEOM8X_DRIVER_UBX_NAV_PVT) && (defined NEOM8X_DRIVER_GPS_DATA_POSITION))
+/*******************************************************************/
+static uint32_t _NEOM8X_read_ubx_u32(uint8_t* data) {
+    // UBX fields are little-endian.
+    return ((uint32_t) data[0] | ((uint32_t) data[1] << 8) | ((uint32_t) data[2] << 16) | ((uint32_t) data[3] << 24));
+}
+#endif
+
+#if ((defined NEOM8X_DRIVER_UBX_NAV_PVT) && (defined NEOM8X_DRIVER_GPS_DATA_TIME))
+/*******************************************************************/
+static void _NEOM8X_parse_ubx_nav_pvt_time(uint8_t* ubx_nav_pvt, NEOM8X_time_t* gps_time, uint8_t* decode_success_flag) {
+    // Reset flag.
+    (*decode_success_flag) = 0;
+    // Check date and time validity.
+    if ((ubx_nav_pvt[NEOM8X_UBX_NAV_PVT_OFFSET_VALID] & NEOM8X_UBX_NAV_PVT_VALID_DATE_TIME) != NEOM8X_UBX_NAV_PVT_VALID_DATE_TIME) goto errors;
+    // Parse fields.
+    gps_time->year = (uint16_t) (ubx_nav_pvt[NEOM8X_UBX_NAV_PVT_OFFSET_YEAR] | (ubx_nav_pvt[NEOM8X_UBX_NAV_PVT_OFFSET_YEAR + 1] << 8));
+    gps_time->month = ubx_nav_pvt[NEOM8X_UBX_NAV_PVT_OFFSET_MONTH];
+    gps_time->date = ubx_nav_pvt[NEOM8X_UBX_NAV_PVT_OFFSET_DAY];
+    gps_time->hours = ubx_nav_pvt[NEOM8X_UBX_NAV_PVT_OFFSET_HOUR];
+    gps_time->minutes = ubx_nav_pvt[NEOM8X_UBX_NAV_PVT_OFFSET_MIN];
+    gps_time->seconds = ubx_nav_pvt[NEOM8X_UBX_NAV_PVT_OFFSET_SEC];
+    // Check decoded time.
+    (*decode_success_flag) = _NEOM8X_check_time(gps_time);
+errors:
+    return;
+}
+#endif
+
+#if ((defined NEOM8X_DRIVER_UBX_NAV_PVT) && (defined NEOM8X_DRIVER_GPS_DATA_POSITION))
+/*******************************************************************/
+static void _NEOM8X_convert_ubx_coordinate(int32_t coordinate_e7, uint8_t* degrees, uint8_t* minutes, uint32_t* seconds, uint8_t* positive_flag) {
+    // Local variables.
+    uint32_t absolute_e7 = 0;
+    uint32_t minutes_e7 = 0;
+    uint32_t fraction = 0;
+    // Sign.
+    (*positive_flag) = (coordinate_e7 >= 0) ? 1 : 0;
+    absolute_e7 = (coordinate_e7 >= 0) ? ((uint32_t) coordinate_e7) : ((uint32_t) (-coordinate_e7));
+    // Degrees.
+    (*degrees) = (uint8_t) (absolute_e7 / 10000000);
+    // Minutes and fractional part of minutes with 5 digits (rounded).
+    minutes_e7 = (absolute_e7 % 10000000) * 60;
+    (*minutes) = (uint8_t) (minutes_e7 / 10000000);
+    fraction = (((minutes_e7 % 10000000) + 50) / 100);
+    (*seconds) = (fraction > 99999) ? 99999 : fraction;
+}
+
+/*******************************************************************/
+static void _NEOM8X_parse_ubx_nav_pvt_position(uint8_t* ubx_nav_pvt, NEOM8X_position_t* gps_position, NEOM8X_position_e7_t* gps_position_e7, NEOM8X_fix_quality_t* fix_quality, uint8_t* decode_success_flag) {
+    // Local variables.
+    uint8_t fix_type = ubx_nav_pvt[NEOM8X_UBX_NAV_PVT_OFFSET_FIX_TYPE];
+    int32_t altitude_mm = 0;
+    uint32_t pdop = 0;
+    // Reset flag.
+    (*decode_success_flag) = 0;
+    // Check fix validity.
+    if ((ubx_nav_pvt[NEOM8X_UBX_NAV_PVT_OFFSET_FLAGS] & NEOM8X_UBX_NAV_PVT_FLAGS_GNSS_FIX_OK) == 0) goto errors;
+    if ((fix_type != NEOM8X_UBX_NAV_PVT_FIX_TYPE_3D) && (fix_type != NEOM8X_UBX_NAV_PVT_FIX_TYPE_GNSS_DR)) goto errors;
+    // Latitude and longitude are expressed in 1e-7 degrees.
+    gps_position_e7->latitude_e7 = (int32_t) _NEOM8X_read_ubx_u32(&(ubx_nav_pvt[NEOM8X_UBX_NAV_PVT_OFFSET_LAT]));
+    gps_position_e7->longitude_e7 = (int32_t) _NEOM8X_read_ubx_u32(&(ubx_nav_pvt[NEOM8X_UBX_NAV_PVT_OFFSET_LON]));
+    _NEOM8X_convert_ubx_coordinate(gps_position_e7->latitude_e7, &(gps_position->lat_degrees), &(gps_position->lat_minutes), &(gps_position->lat_seconds), &(gps_position->lat_north_flag));
+    _NEOM8X_convert_ubx_coordinate(gps_position_e7->longitude_e7, &(gps_position->long_degrees), &(gps_position->long_minutes), &(gps_position->long_seconds), &(gps_position->long_east_flag));
+    // Altitude above mean sea level is expressed in mm.
+    altitude_mm = (int32_t) _NEOM8X_read_ubx_u32(&(ubx_nav_pvt[NEOM8X_UBX_NAV_PVT_OFFSET_HMSL]));
+    gps_position_e7->altitude_mm = altitude_mm;
+    // Altitude is unsigned: clamp to zero and round to the nearest meter.
+    gps_position->altitude = (altitude_mm > 0) ? ((uint32_t) ((altitude_mm + 500) / 1000)) : 0;
+    // Fix type (combined GNSS and dead reckoning fixes are reported as dead reckoning, like GGA quality 6).
+    if (fix_type == NEOM8X_UBX_NAV_PVT_FIX_TYPE_GNSS_DR) {
+        fix_quality->fix_indicator = NEOM8X_FIX_INDICATOR_DEAD_RECKONING;
+    }
+    else if ((ubx_nav_pvt[NEOM8X_UBX_NAV_PVT_OFFSET_FLAGS] & NEOM8X_UBX_NAV_PVT_FLAGS_CARR_SOLN_MASK) == NEOM8X_UBX_NAV_PVT_FLAGS_CARR_SOLN_FIXED) {
+        fix_quality->fix_indicator = NEOM8X_FIX_INDICATOR_RTK_FIXED;
+    }
+    else if ((ubx_nav_pvt[NEOM8X_UBX_NAV_PVT_OFFSET_FLAGS] & NEOM8X_UBX_NAV_PVT_FLAGS_CARR_SOLN_MASK) == NEOM8X_UBX_NAV_PVT_FLAGS_CARR_SOLN_FLOAT) {
+        fix_quality->fix_indicator = NEOM8X_FIX_INDICATOR_RTK_FLOAT;
+    }
+    else if ((ubx_nav_pvt[NEOM8X_UBX_NAV_PVT_OFFSET_FLAGS] & NEOM8X_UBX_NAV_PVT_FLAGS_DIFF_SOLN) != 0) {
+        fix_quality->fix_indicator = NEOM8X_FIX_INDICATOR_DIFFERENTIAL;
+    }
+    else {
+        fix_quality->fix_indicator = NEOM8X_FIX_INDICATOR_AUTONOMOUS;
+    }
+    // Position DOP is expressed in hundredths and used as an upper bound of the HDOP (converted to tenths).
+    fix_quality->number_of_satellites = ubx_nav_pvt[NEOM8X_UBX_NAV_PVT_OFFSET_NUMSV];
+    pdop = (uint32_t) (ubx_nav_pvt[NEOM8X_UBX_NAV_PVT_OFFSET_PDOP] | (ubx_nav_pvt[NEOM8X_UBX_NAV_PVT_OFFSET_PDOP + 1] << 8));
+    fix_quality->hdop = (uint8_t) ((pdop >= (NEOM8X_HDOP_MAX * 10)) ? NEOM8X_HDOP_MAX : (pdop / 10));
+    // Check decoded position.
+    (*decode_success_flag) = _NEOM8X_check_position(gps_position);
+errors:
+    return;
+}
+#endif
+
+/*******************************************************************/
+static NEOM8X_status_t _NEOM8X_send_ubx_command(uint8_t* ubx_command, uint8_t payload_length) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    // Compute checksum.
+    _NEOM8X_compute_ubx_checksum(ubx_command, payload_length);
+    // Store message class and ID to match the acknowledge.
+    neom8x_ctx.ubx_command_class_id[0] = ubx_command[2];
+    neom8x_ctx.ubx_command_class_id[1] = ubx_command[3];
+    neom8x_ctx.ubx_ack_received_flag = 0;
+    // Send message.
+    status = NEOM8X_HW_send_message(ubx_command, (uint32_t) (NEOM8X_UBX_MSG_OVERHEAD_SIZE_BYTES + payload_length));
+    if (status != NEOM8X_SUCCESS) goto errors;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static NEOM8X_status_t _NEOM8X_set_message_rate(uint8_t message_class, uint8_t message_id, uint8_t rate) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    // See p.174 for UBX message format.
+    uint8_t ubx_cfg_msg[NEOM8X_UBX_MSG_OVERHEAD_SIZE_BYTES + NEOM8X_UBX_CFG_MSG_PAYLOAD_SIZE_BYTES] = {
+        0xB5, 0x62,                                   // Preamble.
+        0x06, 0x01,                                   // UBX message class and ID.
+        NEOM8X_UBX_CFG_MSG_PAYLOAD_SIZE_BYTES, 0x00,  // Length.
+        0x00, 0x00,                                   // Message class and ID.
+        0, 0, 0, 0, 0, 0,                             // Message rate on each port.
+        0x00, 0x00                                    // UBX checksum.
+    };
+    uint8_t idx = 0;
+    // Bytes 6-7 = class and ID of the message to enable or disable.
+    ubx_cfg_msg[6] = message_class;
+    ubx_cfg_msg[7] = message_id;
+    // Bytes 8-13 = message rate.
+    for (idx = 0; idx < NEOM8X_UBX_CFG_MSG_NUMBER_OF_PORTS; idx++) {
+        ubx_cfg_msg[NEOM8X_UBX_CFG_MSG_RATE_OFFSET + idx] = rate;
+    }
+    // Send message.
+    status = _NEOM8X_send_ubx_command(ubx_cfg_msg, NEOM8X_UBX_CFG_MSG_PAYLOAD_SIZE_BYTES);
+    if (status != NEOM8X_SUCCESS) goto errors;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static NEOM8X_status_t _NEOM8X_set_port_configuration(uint32_t baud_rate, uint8_t output_protocol_mask) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    // See p.185 for UBX message format.
+    uint8_t ubx_cfg_prt[NEOM8X_UBX_MSG_OVERHEAD_SIZE_BYTES + NEOM8X_UBX_CFG_PRT_PAYLOAD_SIZE_BYTES] = {
+        0xB5, 0x62,                                   // Preamble.
+        0x06, 0x00,                                   // UBX message class and ID.
+        NEOM8X_UBX_CFG_PRT_PAYLOAD_SIZE_BYTES, 0x00,  // Length.
+        0x01,                                         // Port ID (UART1).
+        0x00,                                         // Reserved.
+        0x00, 0x00,                                   // TX ready.
+        0xC0, 0x08, 0x00, 0x00,                       // Mode (8 bits, no parity, 1 stop bit).
+        0x00, 0x00, 0x00, 0x00,                       // Baud rate.
+        0x07, 0x00,                                   // Input protocols (UBX, NMEA, RTCM2).
+        0x00, 0x00,                                   // Output protocols.
+        0x00, 0x00,                                   // Flags.
+        0x00, 0x00,                                   // Reserved.
+        0x00, 0x00                                    // UBX checksum.
+    };
+    uint8_t idx = 0;
+    // Bytes 14-17 = baud rate.
+    for (idx = 0; idx < 4; idx++) {
+        ubx_cfg_prt[NEOM8X_UBX_CFG_PRT_BAUD_RATE_OFFSET + idx] = (uint8_t) ((baud_rate >> (8 * idx)) & 0xFF);
+    }
+    // Byte 20 = output protocols.
+    ubx_cfg_prt[20] = output_protocol_mask;
+    // Send message.
+    status = _NEOM8X_send_ubx_command(ubx_cfg_prt, NEOM8X_UBX_CFG_PRT_PAYLOAD_SIZE_BYTES);
+    if (status != NEOM8X_SUCCESS) goto errors;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static uint8_t _NEOM8X_is_configuration_step_required(uint8_t step) {
+    // Local variables.
+    uint8_t required_flag = 0;
+    uint32_t step_bit = (0b1 << step);
+    // Check cache.
+    if ((neom8x_ctx.known_configuration_mask & step_bit) == 0) {
+        required_flag = 1;
+    }
+    if (step < NEOM8X_NMEA_MESSAGE_INDEX_LAST) {
+        // NMEA messages rate is useless when the port does not output NMEA protocol.
+        if ((neom8x_ctx.configuration.port_output_protocol_mask & NEOM8X_UBX_PROTOCOL_NMEA) == 0) {
+            required_flag = 0;
+        }
+        else if (((neom8x_ctx.applied_configuration.nmea_message_mask ^ neom8x_ctx.configuration.nmea_message_mask) & step_bit) != 0) {
+            required_flag = 1;
+        }
+    }
+    else if (step == NEOM8X_CONFIGURATION_STEP_PORT) {
+        if (neom8x_ctx.applied_configuration.port_output_protocol_mask != neom8x_ctx.configuration.port_output_protocol_mask) {
+            required_flag = 1;
+        }
+    }
+    else if (step == NEOM8X_CONFIGURATION_STEP_RATE) {
+        if (neom8x_ctx.applied_configuration.measurement_period_ms != neom8x_ctx.configuration.measurement_period_ms) {
+            required_flag = 1;
+        }
+    }
+#ifdef NEOM8X_DRIVER_UBX_NAV_PVT
+    else if (step == NEOM8X_CONFIGURATION_STEP_UBX_NAV_PVT) {
+        if (neom8x_ctx.applied_configuration.ubx_nav_pvt_rate != neom8x_ctx.configuration.ubx_nav_pvt_rate) {
+            required_flag = 1;
+        }
+    }
+#endif
+#ifdef NEOM8X_DRIVER_POWER_SAVE
+    else if (step == NEOM8X_CONFIGURATION_STEP_POWER_SAVE) {
+        // Power save settings are useless in continuous mode.
+        if (neom8x_ctx.configuration.low_power_flag == 0) {
+            required_flag = 0;
+        }
+        else if ((neom8x_ctx.applied_configuration.power_save_mode != neom8x_ctx.configuration.power_save_mode) ||
+                 (neom8x_ctx.applied_configuration.power_save_period_ms != neom8x_ctx.configuration.power_save_period_ms))
+        {
+            required_flag = 1;
+        }
+    }
+    else if (step == NEOM8X_CONFIGURATION_STEP_LOW_POWER_MODE) {
+        if (neom8x_ctx.applied_configuration.low_power_flag != neom8x_ctx.configuration.low_power_flag) {
+            required_flag = 1;
+        }
+    }
+#endif
+    return required_flag;
+}
+
+/*******************************************************************/
+static void _NEOM8X_update_configuration_cache(uint8_t step) {
+    // Local variables.
+    uint32_t step_bit = (0b1 << step);
+    // Copy applied value.
+    if (step < NEOM8X_NMEA_MESSAGE_INDEX_LAST) {
+        neom8x_ctx.applied_configuration.nmea_message_mask &= ~step_bit;
+        neom8x_ctx.applied_configuration.nmea_message_mask |= (neom8x_ctx.configuration.nmea_message_mask & step_bit);
+    }
+    else if (step == NEOM8X_CONFIGURATION_STEP_PORT) {
+        neom8x_ctx.applied_configuration.port_output_protocol_mask = neom8x_ctx.configuration.port_output_protocol_mask;
+    }
+    else if (step == NEOM8X_CONFIGURATION_STEP_RATE) {
+        neom8x_ctx.applied_configuration.measurement_period_ms = neom8x_ctx.configuration.measurement_period_ms;
+    }
+#ifdef NEOM8X_DRIVER_UBX_NAV_PVT
+    else if (step == NEOM8X_CONFIGURATION_STEP_UBX_NAV_PVT) {
+        neom8x_ctx.applied_configuration.ubx_nav_pvt_rate = neom8x_ctx.configuration.ubx_nav_pvt_rate;
+    }
+#endif
+#ifdef NEOM8X_DRIVER_POWER_SAVE
+    else if (step == NEOM8X_CONFIGURATION_STEP_POWER_SAVE) {
+        neom8x_ctx.applied_configuration.power_save_mode = neom8x_ctx.configuration.power_save_mode;
+        neom8x_ctx.applied_configuration.power_save_period_ms = neom8x_ctx.configuration.power_save_period_ms;
+    }
+    else if (step == NEOM8X_CONFIGURATION_STEP_LOW_POWER_MODE) {
+        neom8x_ctx.applied_configuration.low_power_flag = neom8x_ctx.configuration.low_power_flag;
+    }
+#endif
+    neom8x_ctx.known_configuration_mask |= step_bit;
+}
+
+/*******************************************************************/
+static NEOM8X_status_t _NEOM8X_set_measurement_rate(uint16_t measurement_period_ms) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    // See p.221 for UBX message format.
+    uint8_t ubx_cfg_rate[NEOM8X_UBX_MSG_OVERHEAD_SIZE_BYTES + NEOM8X_UBX_CFG_RATE_PAYLOAD_SIZE_BYTES] = {
+        0xB5, 0x62,                                     // Preamble.
+        0x06, 0x08,                                     // UBX message class and ID.
+        NEOM8X_UBX_CFG_RATE_PAYLOAD_SIZE_BYTES, 0x00,   // Length.
+        0x00, 0x00,                                     // Measurement period.
+        0x01, 0x00,                                     // Navigation rate (1 solution per measurement).
+        0x01, 0x00,                                     // Time reference (GPS).
+        0x00, 0x00                                      // UBX checksum.
+    };
+    // Bytes 6-7 = measurement period.
+    ubx_cfg_rate[6] = (uint8_t) ((measurement_period_ms >> 0) & 0xFF);
+    ubx_cfg_rate[7] = (uint8_t) ((measurement_period_ms >> 8) & 0xFF);
+    // Send message.
+    status = _NEOM8X_send_ubx_command(ubx_cfg_rate, NEOM8X_UBX_CFG_RATE_PAYLOAD_SIZE_BYTES);
+    if (status != NEOM8X_SUCCESS) goto errors;
+errors:
+    return status;
+}
+
+#ifdef NEOM8X_DRIVER_POWER_SAVE
+/*******************************************************************/
+static NEOM8X_status_t _NEOM8X_set_power_save_configuration(uint8_t power_save_mode, uint32_t power_save_period_ms) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    // See CFG-PM2 section for UBX message format.
+    uint8_t ubx_cfg_pm2[NEOM8X_UBX_MSG_OVERHEAD_SIZE_BYTES + NEOM8X_UBX_CFG_PM2_PAYLOAD_SIZE_BYTES] = {
+        0xB5, 0x62,                                   // Preamble.
+        0x06, 0x3B,                                   // UBX message class and ID.
+        NEOM8X_UBX_CFG_PM2_PAYLOAD_SIZE_BYTES, 0x00,  // Length.
+        0x01,                                         // Message version.
+        0x00,                                         // Reserved.
+        0x00,                                         // Maximum startup state duration (default).
+        0x00,                                         // Reserved.
+        0x00, 0x10, 0x00, 0x00,                       // Flags (ephemeris update, ON/OFF mode).
+        0x00, 0x00, 0x00, 0x00,                       // Update period.
+        0x00, 0x00, 0x00, 0x00,                       // Search period.
+        0x00, 0x00, 0x00, 0x00,                       // Grid offset.
+        0x00, 0x00,                                   // On time.
+        0x00, 0x00,                                   // Minimum acquisition time.
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,                 // Reserved.
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0,                 // Reserved.
+        0x00, 0x00                                    // UBX checksum.
+    };
+    uint8_t idx = 0;
+    // Byte 12 = power save mode.
+    if (power_save_mode == NEOM8X_POWER_MODE_CYCLIC_TRACKING) {
+        ubx_cfg_pm2[12] = NEOM8X_UBX_CFG_PM2_MODE_CYCLIC_TRACKING;
+    }
+    // Bytes 14-17 = update period and bytes 18-21 = search period.
+    for (idx = 0; idx < 4; idx++) {
+        ubx_cfg_pm2[14 + idx] = (uint8_t) ((power_save_period_ms >> (8 * idx)) & 0xFF);
+        ubx_cfg_pm2[18 + idx] = (uint8_t) ((NEOM8X_UBX_CFG_PM2_SEARCH_PERIOD_MS >> (8 * idx)) & 0xFF);
+    }
+    // Send message.
+    status = _NEOM8X_send_ubx_command(ubx_cfg_pm2, NEOM8X_UBX_CFG_PM2_PAYLOAD_SIZE_BYTES);
+    if (status != NEOM8X_SUCCESS) goto errors;
+errors:
+    return status;
+}
+#endif
+
+#ifdef NEOM8X_DRIVER_POWER_SAVE
+/*******************************************************************/
+static NEOM8X_status_t _NEOM8X_set_low_power_mode(uint8_t low_power_flag) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    // See CFG-RXM section for UBX message format.
+    uint8_t ubx_cfg_rxm[NEOM8X_UBX_MSG_OVERHEAD_SIZE_BYTES + NEOM8X_UBX_CFG_RXM_PAYLOAD_SIZE_BYTES] = {
+        0xB5, 0x62,                                   // Preamble.
+        0x06, 0x11,                                   // UBX message class and ID.
+        NEOM8X_UBX_CFG_RXM_PAYLOAD_SIZE_BYTES, 0x00,  // Length.
+        0x08,                                         // Reserved.
+        0x00,                                         // Low power mode.
+        0x00, 0x00                                    // UBX checksum.
+    };
+    // Byte 7 = low power mode (0 = continuous, 1 = power save).
+    ubx_cfg_rxm[7] = (low_power_flag == 0) ? 0x00 : 0x01;
+    // Send message.
+    status = _NEOM8X_send_ubx_command(ubx_cfg_rxm, NEOM8X_UBX_CFG_RXM_PAYLOAD_SIZE_BYTES);
+    if (status != NEOM8X_SUCCESS) goto errors;
+errors:
+    return status;
+}
+#endif
+
+#ifdef NEOM8X_DRIVER_POWER_SAVE
+/*******************************************************************/
+static NEOM8X_status_t _NEOM8X_enter_backup_mode(void) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    // See RXM-PMREQ section for UBX message format.
+    uint8_t ubx_rxm_pmreq[NEOM8X_UBX_MSG_OVERHEAD_SIZE_BYTES + NEOM8X_UBX_RXM_PMREQ_PAYLOAD_SIZE_BYTES] = {
+        0xB5, 0x62,                                     // Preamble.
+        0x02, 0x41,                                     // UBX message class and ID.
+        NEOM8X_UBX_RXM_PMREQ_PAYLOAD_SIZE_BYTES, 0x00,  // Length.
+        0x00,                                           // Message version.
+        0x00, 0x00, 0x00,                               // Reserved.
+        0x00, 0x00, 0x00, 0x00,                         // Duration (infinite).
+        0x02, 0x00, 0x00, 0x00,                         // Flags (backup).
+        0x08, 0x00, 0x00, 0x00,                         // Wake-up sources (UART RX).
+        0x00, 0x00                                      // UBX checksum.
+    };
+    // Send message (the module does not acknowledge this command).
+    _NEOM8X_compute_ubx_checksum(ubx_rxm_pmreq, NEOM8X_UBX_RXM_PMREQ_PAYLOAD_SIZE_BYTES);
+    status = NEOM8X_HW_send_message(ubx_rxm_pmreq, (uint32_t) sizeof(ubx_rxm_pmreq));
+    if (status != NEOM8X_SUCCESS) goto errors;
+    // Configuration stored in RAM is lost in backup mode.
+    neom8x_ctx.module_sleeping_flag = 1;
+    neom8x_ctx.known_configuration_mask = 0;
+errors:
+    return status;
+}
+#endif
+
+#ifdef NEOM8X_DRIVER_POWER_SAVE
+/*******************************************************************/
+static NEOM8X_status_t _NEOM8X_wake_up(void) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    uint8_t wake_up_sequence[NEOM8X_WAKE_UP_SEQUENCE_SIZE_BYTES];
+    uint8_t idx = 0;
+    // Any activity on the UART wakes the module up (these bytes are lost, the next commands are retried on timeout).
+    for (idx = 0; idx < NEOM8X_WAKE_UP_SEQUENCE_SIZE_BYTES; idx++) {
+        wake_up_sequence[idx] = 0xFF;
+    }
+    status = NEOM8X_HW_send_message(wake_up_sequence, NEOM8X_WAKE_UP_SEQUENCE_SIZE_BYTES);
+    if (status != NEOM8X_SUCCESS) goto errors;
+    neom8x_ctx.module_sleeping_flag = 0;
+errors:
+    return status;
+}
+#endif
+
+#ifdef NEOM8X_DRIVER_UBX_MGA
+/*******************************************************************/
+static NEOM8X_status_t _NEOM8X_wait_ubx_ack(void) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    uint32_t delay_ms = 0;
+    // Wait for the acknowledge of the last command.
+    while (1) {
+        if ((neom8x_ctx.ubx_ack_received_flag != 0) &&
+            (neom8x_ctx.ubx_ack_class_id[0] == neom8x_ctx.ubx_command_class_id[0]) &&
+            (neom8x_ctx.ubx_ack_class_id[1] == neom8x_ctx.ubx_command_class_id[1]))
+        {
+            break;
+        }
+        // Exit if timeout.
+        if (delay_ms >= NEOM8X_UBX_ACK_TIMEOUT_MS) {
+            status = NEOM8X_ERROR_UBX_ACK_TIMEOUT;
+            goto errors;
+        }
+        status = NEOM8X_HW_delay_milliseconds(NEOM8X_UBX_ACK_POLLING_PERIOD_MS);
+        if (status != NEOM8X_SUCCESS) goto errors;
+        delay_ms += NEOM8X_UBX_ACK_POLLING_PERIOD_MS;
+    }
+    // Clear flag.
+    neom8x_ctx.ubx_ack_received_flag = 0;
+    // Check acknowledge type.
+    if (neom8x_ctx.ubx_ack_id != NEOM8X_UBX_ID_ACK_ACK) {
+        status = NEOM8X_ERROR_UBX_NAK;
+        goto errors;
+    }
+errors:
+    return status;
+}
+#endif
+
+#ifdef NEOM8X_DRIVER_UBX_MGA
+/*******************************************************************/
+static NEOM8X_status_t _NEOM8X_enable_aiding_acknowledge(void) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    // See CFG-NAVX5 section for UBX message format.
+    uint8_t ubx_cfg_navx5[NEOM8X_UBX_MSG_OVERHEAD_SIZE_BYTES + NEOM8X_UBX_CFG_NAVX5_PAYLOAD_SIZE_BYTES] = {
+        0xB5, 0x62,                                     // Preamble.
+        0x06, 0x23,                                     // UBX message class and ID.
+        NEOM8X_UBX_CFG_NAVX5_PAYLOAD_SIZE_BYTES, 0x00,  // Length.
+        0x02, 0x00,                                     // Version.
+        0x00, 0x04,                                     // Mask 1 (only aiding acknowledge setting is applied).
+        0x00, 0x00, 0x00, 0x00,                         // Mask 2.
+        0x00, 0x00,                                     // Reserved.
+        0, 0, 0,                                        // Minimum and maximum number of satellites, minimum C/N0.
+        0x00,                                           // Reserved.
+        0,                                              // Initial 3D fix.
+        0x00, 0x00,                                     // Reserved.
+        0x01,                                           // Aiding acknowledge.
+        0x00, 0x00,                                     // Week number rollover.
+        0,                                              // Signal attenuation compensation.
+        0x00, 0x00, 0x00, 0x00, 0x00,                   // Reserved.
+        0, 0,                                           // PPP and AssistNow Autonomous.
+        0x00, 0x00,                                     // Reserved.
+        0x00, 0x00,                                     // AssistNow Autonomous maximum orbit error.
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,       // Reserved.
+        0,                                              // ADR.
+        0x00, 0x00                                      // UBX checksum.
+    };
+    // Send command and wait for acknowledge.
+    status = _NEOM8X_send_ubx_command(ubx_cfg_navx5, NEOM8X_UBX_CFG_NAVX5_PAYLOAD_SIZE_BYTES);
+    if (status != NEOM8X_SUCCESS) goto errors;
+    status = _NEOM8X_wait_ubx_ack();
+    if (status != NEOM8X_SUCCESS) goto errors;
+errors:
+    return status;
+}
+#endif
+
+#ifdef NEOM8X_DRIVER_UBX_MGA
+/*******************************************************************/
+static NEOM8X_status_t _NEOM8X_wait_mga_ack(uint8_t* mga_message, uint8_t* accepted_flag) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    uint16_t payload_size = (uint16_t) (mga_message[4] | (mga_message[5] << 8));
+    uint8_t payload_start_size = (payload_size < NEOM8X_UBX_MGA_PAYLOAD_START_SIZE_BYTES) ? ((uint8_t) payload_size) : NEOM8X_UBX_MGA_PAYLOAD_START_SIZE_BYTES;
+    uint32_t delay_ms = 0;
+    uint8_t idx = 0;
+    // Aiding messages are identified by their ID and the first bytes of their payload.
+    while (1) {
+        if ((neom8x_ctx.mga_ack_received_flag != 0) && (neom8x_ctx.mga_ack[3] == mga_message[3])) {
+            for (idx = 0; idx < payload_start_size; idx++) {
+                if (neom8x_ctx.mga_ack[NEOM8X_UBX_MGA_ACK_PAYLOAD_START_OFFSET + idx] != mga_message[NEOM8X_UBX_PAYLOAD_OFFSET + idx]) break;
+            }
+            if (idx >= payload_start_size) break;
+        }
+        // Exit if timeout.
+        if (delay_ms >= NEOM8X_UBX_ACK_TIMEOUT_MS) {
+            status = NEOM8X_ERROR_UBX_ACK_TIMEOUT;
+            goto errors;
+        }
+        status = NEOM8X_HW_delay_milliseconds(NEOM8X_UBX_ACK_POLLING_PERIOD_MS);
+        if (status != NEOM8X_SUCCESS) goto errors;
+        delay_ms += NEOM8X_UBX_ACK_POLLING_PERIOD_MS;
+    }
+    // Clear flag and read acknowledge type.
+    neom8x_ctx.mga_ack_received_flag = 0;
+    (*accepted_flag) = (neom8x_ctx.mga_ack[0] == NEOM8X_UBX_MGA_ACK_TYPE_ACCEPTED) ? 1 : 0;
+errors:
+    return status;
+}
+#endif
+
+#ifdef NEOM8X_DRIVER_UBX_MGA
+/*******************************************************************/
+static NEOM8X_status_t _NEOM8X_send_mga_message(uint8_t* mga_message, uint32_t mga_message_size_bytes, uint8_t* accepted_flag) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    uint8_t idx = 0;
+    // Next message is only sent once the previous one has been acknowledged, so that the receiver input buffer never overflows.
+    for (idx = 0; idx <= NEOM8X_UBX_COMMAND_RETRY_MAX; idx++) {
+        neom8x_ctx.mga_ack_received_flag = 0;
+        status = NEOM8X_HW_send_message(mga_message, mga_message_size_bytes);
+        if (status != NEOM8X_SUCCESS) goto errors;
+        status = _NEOM8X_wait_mga_ack(mga_message, accepted_flag);
+        if (status != NEOM8X_ERROR_UBX_ACK_TIMEOUT) break;
+    }
+errors:
+    return status;
+}
+#endif
+
+#ifdef NEOM8X_DRIVER_UBX_MGA
+/*******************************************************************/
+static NEOM8X_status_t _NEOM8X_start_aiding(void) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    // Check state.
+    if (neom8x_ctx.acquisition.gps_data != NEOM8X_GPS_DATA_NONE) {
+        status = NEOM8X_ERROR_ACQUISITION_RUNNING;
+        goto errors;
+    }
+    // Start reception.
+    status = NEOM8X_HW_start_rx();
+    if (status != NEOM8X_SUCCESS) goto errors;
+    // Acknowledge is disabled by default and lost on module reset.
+    status = _NEOM8X_enable_aiding_acknowledge();
+    if (status != NEOM8X_SUCCESS) {
+        NEOM8X_HW_stop_rx();
+        goto errors;
+    }
+errors:
+    return status;
+}
+#endif
+
+#ifdef NEOM8X_DRIVER_UBX_MGA
+/*******************************************************************/
+static NEOM8X_status_t _NEOM8X_inject_mga_message(uint8_t* mga_message, uint8_t payload_length) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    uint8_t accepted_flag = 0;
+    // Compute checksum.
+    _NEOM8X_compute_ubx_checksum(mga_message, payload_length);
+    // Send message with acknowledge based flow control.
+    status = _NEOM8X_start_aiding();
+    if (status != NEOM8X_SUCCESS) goto errors;
+    status = _NEOM8X_send_mga_message(mga_message, (uint32_t) (NEOM8X_UBX_MSG_OVERHEAD_SIZE_BYTES + payload_length), &accepted_flag);
+    NEOM8X_HW_stop_rx();
+    if (status != NEOM8X_SUCCESS) goto errors;
+    // Message not used by the receiver.
+    if (accepted_flag == 0) {
+        status = NEOM8X_ERROR_UBX_NAK;
+        goto errors;
+    }
+errors:
+    return status;
+}
+#endif
+
+#ifdef NEOM8X_DRIVER_UBX_SOS
+/*******************************************************************/
+static NEOM8X_status_t _NEOM8X_send_sos_command(uint8_t* ubx_upd_sos, uint8_t payload_length, uint8_t response_command, uint32_t timeout_ms) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    uint32_t delay_ms = 0;
+    // Compute checksum.
+    _NEOM8X_compute_ubx_checksum(ubx_upd_sos, payload_length);
+    // Send message.
+    neom8x_ctx.sos_response_received_flag = 0;
+    status = NEOM8X_HW_send_message(ubx_upd_sos, (uint32_t) (NEOM8X_UBX_MSG_OVERHEAD_SIZE_BYTES + payload_length));
+    if (status != NEOM8X_SUCCESS) goto errors;
+    // Wait for the response.
+    while ((neom8x_ctx.sos_response_received_flag == 0) || (neom8x_ctx.sos_command != response_command)) {
+        // Exit if timeout.
+        if (delay_ms >= timeout_ms) {
+            status = NEOM8X_ERROR_UBX_ACK_TIMEOUT;
+            goto errors;
+        }
+        status = NEOM8X_HW_delay_milliseconds(NEOM8X_UBX_ACK_POLLING_PERIOD_MS);
+        if (status != NEOM8X_SUCCESS) goto errors;
+        delay_ms += NEOM8X_UBX_ACK_POLLING_PERIOD_MS;
+    }
+    neom8x_ctx.sos_response_received_flag = 0;
+errors:
+    return status;
+}
+#endif
+
+#ifdef NEOM8X_DRIVER_UBX_SOS
+/*******************************************************************/
+static NEOM8X_status_t _NEOM8X_poll_backup_restore_status(void) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    // See UPD-SOS section for UBX message format.
+    uint8_t ubx_upd_sos_poll[NEOM8X_UBX_MSG_OVERHEAD_SIZE_BYTES] = {
+        0xB5, 0x62,                                   // Preamble.
+        NEOM8X_UBX_CLASS_UPD, NEOM8X_UBX_ID_UPD_SOS,  // UBX message class and ID.
+        0x00, 0x00,                                   // Length.
+        0x00, 0x00                                    // UBX checksum.
+    };
+    // Send poll request (the response is stored by the reception interrupt).
+    _NEOM8X_compute_ubx_checksum(ubx_upd_sos_poll, 0);
+    status = NEOM8X_HW_send_message(ubx_upd_sos_poll, (uint32_t) sizeof(ubx_upd_sos_poll));
+    if (status != NEOM8X_SUCCESS) goto errors;
+errors:
+    return status;
+}
+#endif
+
+#ifdef NEOM8X_DRIVER_UBX_SOS
+/*******************************************************************/
+static NEOM8X_status_t _NEOM8X_send_gnss_reset(uint8_t reset_mode) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    // See CFG-RST section for UBX message format.
+    uint8_t ubx_cfg_rst[NEOM8X_UBX_MSG_OVERHEAD_SIZE_BYTES + NEOM8X_UBX_CFG_RST_PAYLOAD_SIZE_BYTES] = {
+        0xB5, 0x62,                                   // Preamble.
+        0x06, 0x04,                                   // UBX message class and ID.
+        NEOM8X_UBX_CFG_RST_PAYLOAD_SIZE_BYTES, 0x00,  // Length.
+        0x00, 0x00,                                   // Battery backed RAM sections to clear (none).
+        reset_mode,                                   // Reset mode (controlled GNSS stop or start).
+        0x00,                                         // Reserved.
+        0x00, 0x00                                    // UBX checksum.
+    };
+    // Send command (not acknowledged).
+    _NEOM8X_compute_ubx_checksum(ubx_cfg_rst, NEOM8X_UBX_CFG_RST_PAYLOAD_SIZE_BYTES);
+    status = NEOM8X_HW_send_message(ubx_cfg_rst, (uint32_t) sizeof(ubx_cfg_rst));
+    if (status != NEOM8X_SUCCESS) goto errors;
+errors:
+    return status;
+}
+#endif
+
+/*******************************************************************/
+static NEOM8X_status_t _NEOM8X_init_hw(void) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    NEOM8X_HW_configuration_t hw_config;
+    // Init hardware interface.
+    hw_config.uart_baud_rate = neom8x_ctx.uart_baud_rate;
+    hw_config.rx_irq_callback = &_NEOM8X_rx_irq_callback;
+#ifdef NEOM8X_DRIVER_RX_BLOCK
+    hw_config.rx_block_callback = &_NEOM8X_rx_block_callback;
+#endif
+    hw_config.timer_irq_callback = &_NEOM8X_timer_irq_callback;
+    status = NEOM8X_HW_init(&hw_config);
+    if (status != NEOM8X_SUCCESS) goto errors;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static NEOM8X_status_t _NEOM8X_start_baud_rate_switch(void) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    // Send new port configuration at current baud rate (acknowledge is not reliable since the module switches immediately).
+    status = _NEOM8X_set_port_configuration(neom8x_ctx.requested_uart_baud_rate, neom8x_ctx.configuration.port_output_protocol_mask);
+    if (status != NEOM8X_SUCCESS) goto errors;
+    // Let the module switch before re-initializing the interface.
+    neom8x_ctx.baud_rate_switch_state = NEOM8X_BAUD_RATE_SWITCH_STATE_DELAY;
+    status = NEOM8X_HW_start_timer(NEOM8X_UART_BAUD_RATE_SWITCH_DELAY_MS);
+    if (status != NEOM8X_SUCCESS) goto errors;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static NEOM8X_status_t _NEOM8X_apply_baud_rate(void) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    // Re-init hardware interface at new baud rate.
+    status = NEOM8X_HW_stop_rx();
+    if (status != NEOM8X_SUCCESS) goto errors;
+    status = NEOM8X_HW_de_init();
+    if (status != NEOM8X_SUCCESS) goto errors;
+    neom8x_ctx.uart_baud_rate = neom8x_ctx.requested_uart_baud_rate;
+    neom8x_ctx.rx_state = NEOM8X_RX_STATE_IDLE;
+    neom8x_ctx.ubx_ack_received_flag = 0;
+    status = _NEOM8X_init_hw();
+    if (status != NEOM8X_SUCCESS) goto errors;
+    status = NEOM8X_HW_start_rx();
+    if (status != NEOM8X_SUCCESS) goto errors;
+#ifdef NEOM8X_DRIVER_UBX_SOS
+    // Poll the navigation backup restore status at the new baud rate.
+    if (neom8x_ctx.backup_restore_status == NEOM8X_BACKUP_RESTORE_STATUS_UNKNOWN) {
+        status = _NEOM8X_poll_backup_restore_status();
+        if (status != NEOM8X_SUCCESS) goto errors;
+    }
+#endif
+    // Force port configuration step so that at least one acknowledge confirms the link.
+    neom8x_ctx.known_configuration_mask &= ~((uint32_t) (0b1 << NEOM8X_CONFIGURATION_STEP_PORT));
+    neom8x_ctx.baud_rate_switch_state = NEOM8X_BAUD_RATE_SWITCH_STATE_CONFIRMATION;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static NEOM8X_status_t _NEOM8X_send_configuration_step(uint8_t step) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    // Send command.
+    if (step < NEOM8X_NMEA_MESSAGE_INDEX_LAST) {
+        status = _NEOM8X_set_message_rate(NEOM8X_UBX_CLASS_NMEA, NEOM8X_NMEA_MESSAGE_ID[step], ((neom8x_ctx.configuration.nmea_message_mask & (0b1 << step)) != 0) ? 1 : 0);
+    }
+    else if (step == NEOM8X_CONFIGURATION_STEP_PORT) {
+        status = _NEOM8X_set_port_configuration(neom8x_ctx.uart_baud_rate, neom8x_ctx.configuration.port_output_protocol_mask);
+    }
+    else if (step == NEOM8X_CONFIGURATION_STEP_RATE) {
+        status = _NEOM8X_set_measurement_rate(neom8x_ctx.configuration.measurement_period_ms);
+    }
+#ifdef NEOM8X_DRIVER_UBX_NAV_PVT
+    else if (step == NEOM8X_CONFIGURATION_STEP_UBX_NAV_PVT) {
+        status = _NEOM8X_set_message_rate(NEOM8X_UBX_CLASS_NAV, NEOM8X_UBX_ID_NAV_PVT, neom8x_ctx.configuration.ubx_nav_pvt_rate);
+    }
+#endif
+#ifdef NEOM8X_DRIVER_POWER_SAVE
+    else if (step == NEOM8X_CONFIGURATION_STEP_POWER_SAVE) {
+        status = _NEOM8X_set_power_save_configuration(neom8x_ctx.configuration.power_save_mode, neom8x_ctx.configuration.power_save_period_ms);
+    }
+    else if (step == NEOM8X_CONFIGURATION_STEP_LOW_POWER_MODE) {
+        status = _NEOM8X_set_low_power_mode(neom8x_ctx.configuration.low_power_flag);
+    }
+#endif
+    return status;
+}
+
+/*******************************************************************/
+static NEOM8X_status_t _NEOM8X_send_release_step(uint8_t step) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    // Directly exit if the module is known to be already configured.
+    if (_NEOM8X_is_configuration_step_required(step) == 0) goto errors;
+    // Send command without waiting for acknowledge (reception is stopped).
+    status = _NEOM8X_send_configuration_step(step);
+    if (status != NEOM8X_SUCCESS) goto errors;
+    // Step is not confirmed, it is applied again by the next acquisition if needed.
+    neom8x_ctx.known_configuration_mask &= ~((uint32_t) (0b1 << step));
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static NEOM8X_status_t _NEOM8X_disable_output(void) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    // Restore default measurement rate.
+    neom8x_ctx.configuration.measurement_period_ms = NEOM8X_MEASUREMENT_PERIOD_DEFAULT_MS;
+    status = _NEOM8X_send_release_step(NEOM8X_CONFIGURATION_STEP_RATE);
+    if (status != NEOM8X_SUCCESS) goto errors;
+#ifdef NEOM8X_DRIVER_UBX_NAV_PVT
+    neom8x_ctx.configuration.ubx_nav_pvt_rate = 0;
+    status = _NEOM8X_send_release_step(NEOM8X_CONFIGURATION_STEP_UBX_NAV_PVT);
+    if (status != NEOM8X_SUCCESS) goto errors;
+#endif
+    // NMEA output is disabled at port level, last since the module may drop the bytes received while reconfiguring its port.
+    neom8x_ctx.configuration.port_output_protocol_mask = NEOM8X_UBX_PROTOCOL_UBX;
+    status = _NEOM8X_send_release_step(NEOM8X_CONFIGURATION_STEP_PORT);
+    if (status != NEOM8X_SUCCESS) goto errors;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static NEOM8X_status_t _NEOM8X_send_configuration_command(void) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    // Skip steps which are already configured.
+    while (neom8x_ctx.configuration_step < NEOM8X_CONFIGURATION_STEP_LAST) {
+        if (_NEOM8X_is_configuration_step_required(neom8x_ctx.configuration_step) != 0) break;
+        neom8x_ctx.configuration_step++;
+    }
+    // Check if configuration is complete.
+    if (neom8x_ctx.configuration_step >= NEOM8X_CONFIGURATION_STEP_LAST) goto errors;
+    // Send command.
+    status = _NEOM8X_send_configuration_step(neom8x_ctx.configuration_step);
+    if (status != NEOM8X_SUCCESS) goto errors;
+    // Start acknowledge timeout.
+    status = NEOM8X_HW_start_timer(NEOM8X_UBX_ACK_TIMEOUT_MS);
+    if (status != NEOM8X_SUCCESS) goto errors;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static NEOM8X_status_t _NEOM8X_start_configuration(void) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    // Reset pipeline.
+    neom8x_ctx.timer_irq_flag = 0;
+    neom8x_ctx.configuration_step = 0;
+    neom8x_ctx.configuration_retry_count = 0;
+    neom8x_ctx.baud_rate_switch_state = NEOM8X_BAUD_RATE_SWITCH_STATE_IDLE;
+    neom8x_ctx.baud_rate_fallback_flag = 0;
+    // Switch baud rate first if required.
+    if (neom8x_ctx.requested_uart_baud_rate != neom8x_ctx.uart_baud_rate) {
+        status = _NEOM8X_start_baud_rate_switch();
+        goto errors;
+    }
+    // Send first command.
+    status = _NEOM8X_send_configuration_command();
+    if (status != NEOM8X_SUCCESS) goto errors;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static NEOM8X_status_t _NEOM8X_abort_acquisition(void) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    NEOM8X_status_t rx_status = NEOM8X_SUCCESS;
+    uint8_t gps_data = neom8x_ctx.acquisition.gps_data;
+    uint8_t data_bit = 0;
+    // Release driver.
+    neom8x_ctx.acquisition.gps_data = NEOM8X_GPS_DATA_NONE;
+    neom8x_ctx.nmea_message_mask = 0;
+#ifdef NEOM8X_DRIVER_UBX_NAV_PVT
+    neom8x_ctx.ubx_nav_pvt_subscribed_flag = 0;
+#endif
+    // Stop timer and reception in any case, the first error is reported.
+    status = NEOM8X_HW_stop_timer();
+    rx_status = NEOM8X_HW_stop_rx();
+    if (status == NEOM8X_SUCCESS) {
+        status = rx_status;
+    }
+    // Report failure for each requested data.
+    for (data_bit = 0b1; data_bit < NEOM8X_GPS_DATA_LAST; data_bit = (uint8_t) (data_bit << 1)) {
+        if ((gps_data & data_bit) != 0) {
+            neom8x_ctx.acquisition.completion_callback((NEOM8X_gps_data_t) data_bit, NEOM8X_ACQUISITION_STATUS_FAIL);
+        }
+    }
+    return status;
+}
+
+/*******************************************************************/
+static NEOM8X_status_t _NEOM8X_process_configuration(void) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    // Invalidate cache if the module has been reset.
+    if (neom8x_ctx.module_reset_detected_flag != 0) {
+        // Clear flag.
+        neom8x_ctx.module_reset_detected_flag = 0;
+        neom8x_ctx.known_configuration_mask = 0;
+        // Apply configuration again if an acquisition is running.
+        if ((neom8x_ctx.acquisition.gps_data != NEOM8X_GPS_DATA_NONE) && (neom8x_ctx.configuration_step >= NEOM8X_CONFIGURATION_STEP_LAST)) {
+            status = _NEOM8X_start_configuration();
+            if (status != NEOM8X_SUCCESS) goto errors;
+        }
+    }
+    // Check if configuration is running.
+    if (neom8x_ctx.configuration_step >= NEOM8X_CONFIGURATION_STEP_LAST) goto errors;
+    // Wait for the module to switch its baud rate.
+    if (neom8x_ctx.baud_rate_switch_state == NEOM8X_BAUD_RATE_SWITCH_STATE_DELAY) {
+        if (neom8x_ctx.timer_irq_flag == 0) goto errors;
+        // Clear flag.
+        neom8x_ctx.timer_irq_flag = 0;
+        // Re-init interface and send first command at new baud rate.
+        status = _NEOM8X_apply_baud_rate();
+        if (status != NEOM8X_SUCCESS) goto errors;
+        status = _NEOM8X_send_configuration_command();
+        if (status != NEOM8X_SUCCESS) goto errors;
+        return status;
+    }
+    // Check acknowledge.
+    if ((neom8x_ctx.ubx_ack_received_flag != 0) &&
+        (neom8x_ctx.ubx_ack_class_id[0] == neom8x_ctx.ubx_command_class_id[0]) &&
+        (neom8x_ctx.ubx_ack_class_id[1] == neom8x_ctx.ubx_command_class_id[1]))
+    {
+        // Clear flags.
+        neom8x_ctx.ubx_ack_received_flag = 0;
+        status = NEOM8X_HW_stop_timer();
+        if (status != NEOM8X_SUCCESS) goto errors;
+        neom8x_ctx.timer_irq_flag = 0;
+        // Any answer confirms the new baud rate.
+        neom8x_ctx.baud_rate_switch_state = NEOM8X_BAUD_RATE_SWITCH_STATE_IDLE;
+        // Check acknowledge type.
+        if (neom8x_ctx.ubx_ack_id != NEOM8X_UBX_ID_ACK_ACK) {
+            status = NEOM8X_ERROR_UBX_NAK;
+            goto errors;
+        }
+        // Update cache.
+        _NEOM8X_update_configuration_cache(neom8x_ctx.configuration_step);
+        // Report the fallback once the link is confirmed at default baud rate.
+        if (neom8x_ctx.baud_rate_fallback_flag != 0) {
+            neom8x_ctx.baud_rate_fallback_flag = 0;
+            status = NEOM8X_ERROR_BAUD_RATE_FALLBACK;
+            goto errors;
+        }
+        // Go to next command.
+        neom8x_ctx.configuration_step++;
+        neom8x_ctx.configuration_retry_count = 0;
+        status = _NEOM8X_send_configuration_command();
+        if (status != NEOM8X_SUCCESS) goto errors;
+    }
+    // Check acknowledge timeout.
+    if (neom8x_ctx.timer_irq_flag != 0) {
+        // Clear flag.
+        neom8x_ctx.timer_irq_flag = 0;
+        // Check retry count.
+        neom8x_ctx.configuration_retry_count++;
+        if (neom8x_ctx.configuration_retry_count > NEOM8X_UBX_COMMAND_RETRY_MAX) {
+            // Fall back to default baud rate if the new link can not be confirmed.
+            if ((neom8x_ctx.baud_rate_switch_state == NEOM8X_BAUD_RATE_SWITCH_STATE_CONFIRMATION) && (neom8x_ctx.uart_baud_rate != NEOM8X_UART_BAUD_RATE_DEFAULT)) {
+                neom8x_ctx.requested_uart_baud_rate = NEOM8X_UART_BAUD_RATE_DEFAULT;
+                neom8x_ctx.baud_rate_fallback_flag = 1;
+                neom8x_ctx.configuration_retry_count = 0;
+                status = _NEOM8X_start_baud_rate_switch();
+                if (status != NEOM8X_SUCCESS) goto errors;
+                return status;
+            }
+            status = NEOM8X_ERROR_UBX_ACK_TIMEOUT;
+            goto errors;
+        }
+        // Send same command again.
+        status = _NEOM8X_send_configuration_command();
+        if (status != NEOM8X_SUCCESS) goto errors;
+    }
+    return status;
+errors:
+    // Abort configuration and acquisition in case of error.
+    if (status != NEOM8X_SUCCESS) {
+        neom8x_ctx.configuration_step = NEOM8X_CONFIGURATION_STEP_LAST;
+        neom8x_ctx.baud_rate_switch_state = NEOM8X_BAUD_RATE_SWITCH_STATE_IDLE;
+        // Configuration error is the first error and is reported instead of the abort status.
+        if (neom8x_ctx.acquisition.gps_data != NEOM8X_GPS_DATA_NONE) {
+            _NEOM8X_abort_acquisition();
+        }
+    }
+    return status;
+}
+
+#ifdef NEOM8X_DRIVER_GPS_DATA_TIME
+/*******************************************************************/
+static void _NEOM8X_update_time(NEOM8X_time_t* gps_time, NEOM8X_acquisition_status_t* acquisition_status) {
+    // Copy data and update status.
+    _NEOM8X_copy_time(gps_time, &(neom8x_ctx.gps_time));
+    (*acquisition_status) = NEOM8X_ACQUISITION_STATUS_FOUND;
+}
+#endif
+
+#if ((defined NEOM8X_DRIVER_GPS_DATA_POSITION) && (NEOM8X_DRIVER_ALTITUDE_STABILITY_FILTER_MODE > 0))
+/*******************************************************************/
+static void _NEOM8X_reset_stability_window(void) {
+    // Restart convergence.
+    neom8x_ctx.stability_window_idx = 0;
+    neom8x_ctx.stability_sample_count = 0;
+}
+
+/*******************************************************************/
+static uint8_t _NEOM8X_update_stability_window(NEOM8X_position_t* gps_position) {
+    // Local variables.
+    NEOM8X_stability_sample_t* sample = NULL;
+    uint8_t window_size = NEOM8X_ALTITUDE_STABILITY_THRESHOLD;
+    int32_t latitude_min = 0;
+    int32_t latitude_max = 0;
+    int32_t longitude_min = 0;
+    int32_t longitude_max = 0;
+    uint32_t altitude_min = 0;
+    uint32_t altitude_max = 0;
+    uint32_t north_threshold = 0;
+    uint32_t east_threshold = 0;
+    uint8_t latitude_band = 0;
+    uint8_t idx = 0;
+    // Store position in 10^-5 minutes units.
+    sample = &(neom8x_ctx.stability_window[neom8x_ctx.stability_window_idx]);
+    sample->latitude = (int32_t) ((((gps_position->lat_degrees) * 60) + (gps_position->lat_minutes)) * NEOM8X_MINUTE_FRACTIONS_PER_MINUTE) + (int32_t) (gps_position->lat_seconds);
+    sample->longitude = (int32_t) ((((gps_position->long_degrees) * 60) + (gps_position->long_minutes)) * NEOM8X_MINUTE_FRACTIONS_PER_MINUTE) + (int32_t) (gps_position->long_seconds);
+    sample->altitude = (gps_position->altitude);
+    if ((gps_position->lat_north_flag) == 0) {
+        sample->latitude = (-(sample->latitude));
+    }
+    if ((gps_position->long_east_flag) == 0) {
+        sample->longitude = (-(sample->longitude));
+    }
+    // Update ring buffer.
+    neom8x_ctx.stability_window_idx = (uint8_t) ((neom8x_ctx.stability_window_idx + 1) % window_size);
+    if (neom8x_ctx.stability_sample_count < window_size) {
+        neom8x_ctx.stability_sample_count++;
+    }
+    // Wait for the window to be full.
+    if (neom8x_ctx.stability_sample_count < window_size) return 0;
+    // Compute window spread.
+    latitude_min = latitude_max = neom8x_ctx.stability_window[0].latitude;
+    longitude_min = longitude_max = neom8x_ctx.stability_window[0].longitude;
+    altitude_min = altitude_max = neom8x_ctx.stability_window[0].altitude;
+    for (idx = 1; idx < window_size; idx++) {
+        sample = &(neom8x_ctx.stability_window[idx]);
+        if ((sample->latitude) < latitude_min) latitude_min = (sample->latitude);
+        if ((sample->latitude) > latitude_max) latitude_max = (sample->latitude);
+        if ((sample->longitude) < longitude_min) longitude_min = (sample->longitude);
+        if ((sample->longitude) > longitude_max) longitude_max = (sample->longitude);
+        if ((sample->altitude) < altitude_min) altitude_min = (sample->altitude);
+        if ((sample->altitude) > altitude_max) altitude_max = (sample->altitude);
+    }
+    // Convert horizontal threshold to 10^-5 minutes (1 minute of latitude = 1 nautical mile).
+    north_threshold = ((uint32_t) NEOM8X_HORIZONTAL_STABILITY_THRESHOLD_M * NEOM8X_MINUTE_FRACTIONS_PER_MINUTE) / NEOM8X_METERS_PER_MINUTE;
+    latitude_band = (uint8_t) ((gps_position->lat_degrees) / 10);
+    if (latitude_band > 8) {
+        latitude_band = 8;
+    }
+    east_threshold = (north_threshold * NEOM8X_COSINE_ONE) / NEOM8X_LATITUDE_BAND_COSINE[latitude_band];
+    // Check convergence.
+    if ((uint32_t) (latitude_max - latitude_min) > north_threshold) return 0;
+    if ((uint32_t) (longitude_max - longitude_min) > east_threshold) return 0;
+    if ((altitude_max - altitude_min) > (uint32_t) NEOM8X_VERTICAL_STABILITY_THRESHOLD_M) return 0;
+    return 1;
+}
+#endif
+
+#ifdef NEOM8X_DRIVER_GPS_DATA_POSITION
+/*******************************************************************/
+static uint8_t _NEOM8X_check_fix_quality(NEOM8X_fix_quality_t* fix_quality) {
+    // Local variables.
+    uint8_t hdop_max = neom8x_ctx.acquisition.hdop_max;
+    // Fix type is provided in all modes.
+    if ((fix_quality->fix_indicator) == NEOM8X_FIX_INDICATOR_NONE) return 0;
+    if ((fix_quality->fix_indicator) < neom8x_ctx.acquisition.fix_indicator_min) return 0;
+    // Satellites and HDOP are not provided by RMC message.
+    if (neom8x_ctx.acquisition.mode == NEOM8X_ACQUISITION_MODE_NMEA_RMC) return 1;
+    if ((fix_quality->number_of_satellites) < neom8x_ctx.acquisition.satellites_min) return 0;
+    if ((hdop_max != 0) && ((fix_quality->hdop) > hdop_max)) return 0;
+    return 1;
+}
+
+/*******************************************************************/
+static void _NEOM8X_update_sky_trend(NEOM8X_fix_quality_t* fix_quality) {
+    // Only track fixes of sufficient type which are rejected by the satellites or HDOP gates.
+    if ((fix_quality == NULL) || ((fix_quality->fix_indicator) == NEOM8X_FIX_INDICATOR_NONE) || ((fix_quality->fix_indicator) < neom8x_ctx.acquisition.fix_indicator_min) || (_NEOM8X_check_fix_quality(fix_quality) != 0)) {
+        neom8x_ctx.sky_trend_epoch_count = 0;
+        goto errors;
+    }
+    if (neom8x_ctx.sky_trend_epoch_count == 0) {
+        _NEOM8X_copy_fix_quality(fix_quality, &(neom8x_ctx.sky_trend_first));
+    }
+    _NEOM8X_copy_fix_quality(fix_quality, &(neom8x_ctx.sky_trend_last));
+    neom8x_ctx.sky_trend_epoch_count++;
+errors:
+    return;
+}
+
+/*******************************************************************/
+static uint32_t _NEOM8X_get_sky_trend_required_epochs(void) {
+    // Local variables.
+    NEOM8X_fix_quality_t* first = &(neom8x_ctx.sky_trend_first);
+    NEOM8X_fix_quality_t* last = &(neom8x_ctx.sky_trend_last);
+    uint32_t trend_epochs = (neom8x_ctx.sky_trend_epoch_count - 1);
+    uint32_t required_epochs = 1;
+    uint32_t epochs = 0;
+    uint8_t satellites_min = neom8x_ctx.acquisition.satellites_min;
+    uint8_t hdop_max = neom8x_ctx.acquisition.hdop_max;
+    // Sky conditions are not projected until the rejections are persistent.
+    if (neom8x_ctx.sky_trend_epoch_count < NEOM8X_SKY_TREND_EPOCHS_MIN) goto errors;
+    // Linear projection of the number of satellites.
+    if ((last->number_of_satellites) < satellites_min) {
+        if ((last->number_of_satellites) <= (first->number_of_satellites)) {
+            required_epochs = NEOM8X_SKY_TREND_UNREACHABLE;
+            goto errors;
+        }
+        epochs = ((uint32_t) (satellites_min - (last->number_of_satellites)) * trend_epochs);
+        epochs = ((epochs + (uint32_t) ((last->number_of_satellites) - (first->number_of_satellites)) - 1) / (uint32_t) ((last->number_of_satellites) - (first->number_of_satellites)));
+        if (epochs > required_epochs) {
+            required_epochs = epochs;
+        }
+    }
+    // Linear projection of the HDOP.
+    if ((hdop_max != 0) && ((last->hdop) > hdop_max)) {
+        if ((last->hdop) >= (first->hdop)) {
+            required_epochs = NEOM8X_SKY_TREND_UNREACHABLE;
+            goto errors;
+        }
+        epochs = ((uint32_t) ((last->hdop) - hdop_max) * trend_epochs);
+        epochs = ((epochs + (uint32_t) ((first->hdop) - (last->hdop)) - 1) / (uint32_t) ((first->hdop) - (last->hdop)));
+        if (epochs > required_epochs) {
+            required_epochs = epochs;
+        }
+    }
+errors:
+    return required_epochs;
+}
+
+/*******************************************************************/
+static void _NEOM8X_update_position(NEOM8X_position_t* gps_position, NEOM8X_position_e7_t* gps_position_e7, NEOM8X_fix_quality_t* fix_quality, NEOM8X_acquisition_status_t* acquisition_status) {
+    // Ignore fixes below the quality gates.
+    (*acquisition_status) = NEOM8X_ACQUISITION_STATUS_FAIL;
+    _NEOM8X_update_sky_trend(fix_quality);
+    if (_NEOM8X_check_fix_quality(fix_quality) == 0) {
+#if (NEOM8X_DRIVER_ALTITUDE_STABILITY_FILTER_MODE > 0)
+        _NEOM8X_reset_stability_window();
+#endif
+        goto errors;
+    }
+    // Copy data and update status.
+    _NEOM8X_copy_position(gps_position, &(neom8x_ctx.gps_position));
+    _NEOM8X_copy_position_e7(gps_position_e7, &(neom8x_ctx.gps_position_e7));
+    _NEOM8X_copy_fix_quality(fix_quality, &(neom8x_ctx.fix_quality));
+    (*acquisition_status) = NEOM8X_ACQUISITION_STATUS_FOUND;
+#if (NEOM8X_DRIVER_ALTITUDE_STABILITY_FILTER_MODE > 0)
+    // Directly exit if the filter is disabled or if altitude is not available.
+    if ((NEOM8X_ALTITUDE_STABILITY_THRESHOLD >= 2) && (neom8x_ctx.acquisition.mode != NEOM8X_ACQUISITION_MODE_NMEA_RMC)) {
+        if (_NEOM8X_update_stability_window(gps_position) != 0) {
+            // Update status.
+            (*acquisition_status) = NEOM8X_ACQUISITION_STATUS_STABLE;
+        }
+    }
+#endif
+    // Keep best status of the acquisition.
+    if ((*acquisition_status) > neom8x_ctx.position_status) {
+        neom8x_ctx.position_status = (*acquisition_status);
+    }
+errors:
+    return;
+}
+
+/*******************************************************************/
+static uint8_t _NEOM8X_is_position_deadline_reachable(void) {
+    // Local variables.
+    NEOM8X_acquisition_status_t position_target = NEOM8X_ACQUISITION_STATUS_FOUND;
+    uint32_t epoch_period_ms = neom8x_ctx.configuration.measurement_period_ms;
+    uint32_t elapsed_ms = 0;
+    uint32_t remaining_epochs = 0;
+    uint32_t required_epochs = 1;
+    uint32_t sky_epochs = 0;
+    // Deadline is disabled.
+    if (neom8x_ctx.acquisition.timeout_ms == 0) return 1;
+#if (NEOM8X_DRIVER_ALTITUDE_STABILITY_FILTER_MODE > 0)
+    // A full window of consecutive fixes is required to report a stable position (at least one more fix when the full window did not converge).
+    if ((NEOM8X_ALTITUDE_STABILITY_THRESHOLD >= 2) && (neom8x_ctx.acquisition.mode != NEOM8X_ACQUISITION_MODE_NMEA_RMC)) {
+        position_target = NEOM8X_ACQUISITION_STATUS_STABLE;
+        if (neom8x_ctx.stability_sample_count < NEOM8X_ALTITUDE_STABILITY_THRESHOLD) {
+            required_epochs = (uint32_t) (NEOM8X_ALTITUDE_STABILITY_THRESHOLD - neom8x_ctx.stability_sample_count);
+        }
+    }
+#endif
+    if (neom8x_ctx.position_status >= position_target) return 1;
+    // While the gates reject the fixes, the first accepted fix is expected when the sky trend reaches them.
+    if (neom8x_ctx.sky_trend_epoch_count != 0) {
+        sky_epochs = _NEOM8X_get_sky_trend_required_epochs();
+        if (sky_epochs == NEOM8X_SKY_TREND_UNREACHABLE) return 0;
+        required_epochs += (sky_epochs - 1);
+    }
+#ifdef NEOM8X_DRIVER_POWER_SAVE
+    // Fixes are computed at the update period in ON/OFF mode.
+    if ((neom8x_ctx.configuration.low_power_flag != 0) && (neom8x_ctx.configuration.power_save_mode == NEOM8X_POWER_MODE_ON_OFF)) {
+        epoch_period_ms = neom8x_ctx.configuration.power_save_period_ms;
+    }
+#endif
+    // Time before the first position message is not counted, so that the deadline is never under-estimated.
+    elapsed_ms = (neom8x_ctx.position_epoch_count * epoch_period_ms);
+    if (elapsed_ms < neom8x_ctx.acquisition.timeout_ms) {
+        remaining_epochs = ((neom8x_ctx.acquisition.timeout_ms - elapsed_ms) / epoch_period_ms);
+    }
+    return ((required_epochs <= remaining_epochs) ? 1 : 0);
+}
+
+/*******************************************************************/
+static void _NEOM8X_process_position(NEOM8X_position_t* gps_position, NEOM8X_position_e7_t* gps_position_e7, NEOM8X_fix_quality_t* fix_quality, uint8_t decode_success_flag) {
+    // Local variables.
+    NEOM8X_acquisition_status_t acquisition_status = NEOM8X_ACQUISITION_STATUS_FAIL;
+    // Ignore messages once the position acquisition has been aborted.
+    if (neom8x_ctx.position_abort_flag != 0) goto errors;
+    // Position message is sent once per navigation epoch, with or without fix.
+    neom8x_ctx.position_epoch_count++;
+    if (decode_success_flag == 0) {
+        _NEOM8X_update_sky_trend(NULL);
+#if (NEOM8X_DRIVER_ALTITUDE_STABILITY_FILTER_MODE > 0)
+        // Consecutive fixes are required: drop the samples collected before a fix loss.
+        _NEOM8X_reset_stability_window();
+#endif
+    }
+    if (decode_success_flag != 0) {
+        _NEOM8X_update_position(gps_position, gps_position_e7, fix_quality, &acquisition_status);
+        if (acquisition_status != NEOM8X_ACQUISITION_STATUS_FAIL) {
+            neom8x_ctx.acquisition.completion_callback(NEOM8X_GPS_DATA_POSITION, acquisition_status);
+        }
+    }
+    // Report failure as soon as the required fixes can't be received before the deadline anymore.
+    if (_NEOM8X_is_position_deadline_reachable() == 0) {
+        neom8x_ctx.position_abort_flag = 1;
+        neom8x_ctx.acquisition.completion_callback(NEOM8X_GPS_DATA_POSITION, NEOM8X_ACQUISITION_STATUS_FAIL);
+    }
+errors:
+    return;
+}
+#endif
+
+/*******************************************************************/
+static void _NEOM8X_get_nmea_message_index(NEOM8X_nmea_sentence_t* nmea_sentence, NEOM8X_nmea_message_index_t* nmea_message_index) {
+    // Local variables.
+    char_t* field = _NEOM8X_get_field(0);
+    uint8_t idx = 0;
+    uint8_t char_idx = 0;
+    // Message name follows the 2 characters talker ID.
+    for (idx = 0; idx < NEOM8X_NMEA_MESSAGE_INDEX_LAST; idx++) {
+        for (char_idx = 0; char_idx < NEOM8X_NMEA_MESSAGE_NAME_SIZE_BYTES; char_idx++) {
+            if (field[2 + char_idx] != NEOM8X_NMEA_MESSAGE_NAME[idx][char_idx]) break;
+        }
+        if (char_idx >= NEOM8X_NMEA_MESSAGE_NAME_SIZE_BYTES) break;
+    }
+    (*nmea_message_index) = idx;
+}
+
+/*******************************************************************/
+static NEOM8X_status_t _NEOM8X_process_nmea_frame(char_t* nmea_rx_buf) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+#ifdef NEOM8X_DRIVER_GPS_DATA_TIME
+    NEOM8X_acquisition_status_t acquisition_status = NEOM8X_ACQUISITION_STATUS_FAIL;
+#endif
+    NEOM8X_nmea_sentence_t nmea_sentence;
+    NEOM8X_nmea_message_index_t nmea_message_index = NEOM8X_NMEA_MESSAGE_INDEX_LAST;
+    uint8_t scan_success_flag = 0;
+#if ((defined NEOM8X_DRIVER_GPS_DATA_TIME) || (defined NEOM8X_DRIVER_GPS_DATA_POSITION))
+    uint8_t decode_success_flag = 0;
+#endif
+#ifdef NEOM8X_DRIVER_GPS_DATA_TIME
+    NEOM8X_time_t gps_time;
+#endif
+#ifdef NEOM8X_DRIVER_GPS_DATA_POSITION
+    NEOM8X_position_t gps_position;
+    NEOM8X_position_e7_t gps_position_e7;
+    NEOM8X_fix_quality_t fix_quality;
+#endif
+#ifdef NEOM8X_DRIVER_SENTENCE_VIEW
+    NEOM8X_sentence_view_t sentence_view;
+#endif
+    // Build fields table.
+    _NEOM8X_scan_nmea_sentence(nmea_rx_buf, &nmea_sentence, &scan_success_flag);
+    if (scan_success_flag == 0) goto errors;
+    // Reset structures.
+#ifdef NEOM8X_DRIVER_GPS_DATA_TIME
+    _NEOM8X_reset_time(&gps_time);
+#endif
+#ifdef NEOM8X_DRIVER_GPS_DATA_POSITION
+    _NEOM8X_reset_position(&gps_position);
+#endif
+    // Decode incoming NMEA message according to its ID.
+    _NEOM8X_get_nmea_message_index(&nmea_sentence, &nmea_message_index);
+    if (nmea_message_index >= NEOM8X_NMEA_MESSAGE_INDEX_LAST) goto errors;
+#ifdef NEOM8X_DRIVER_SENTENCE_VIEW
+    // Give subscribed sentences to the application (the slot is released after the callback returns).
+    if ((neom8x_ctx.sentence_view_mask & (0b1 << nmea_message_index)) != 0) {
+        sentence_view.nmea_message_index = nmea_message_index;
+        sentence_view.sentence = nmea_sentence.buffer;
+        sentence_view.number_of_fields = nmea_sentence.number_of_fields;
+        sentence_view.field_offset = nmea_sentence.field_offset;
+        neom8x_ctx.sentence_view_callback(&sentence_view);
+    }
+    // Messages only enabled by the subscription are not decoded by the driver.
+    if ((neom8x_ctx.nmea_message_mask & (0b1 << nmea_message_index)) == 0) goto errors;
+#endif
+    switch (nmea_message_index) {
+#ifdef NEOM8X_DRIVER_GPS_DATA_TIME
+    case NEOM8X_NMEA_MESSAGE_INDEX_ZDA:
+        if ((neom8x_ctx.acquisition.gps_data & NEOM8X_GPS_DATA_TIME) == 0) break;
+        // Parse buffer.
+        _NEOM8X_parse_nmea_zda(&nmea_sentence, &gps_time, &decode_success_flag);
+        // Check decoding result.
+        if (decode_success_flag != 0) {
+            _NEOM8X_update_time(&gps_time, &acquisition_status);
+            neom8x_ctx.acquisition.completion_callback(NEOM8X_GPS_DATA_TIME, acquisition_status);
+        }
+        break;
+#endif
+#ifdef NEOM8X_DRIVER_GPS_DATA_POSITION
+    case NEOM8X_NMEA_MESSAGE_INDEX_GGA:
+        if ((neom8x_ctx.acquisition.gps_data & NEOM8X_GPS_DATA_POSITION) == 0) break;
+        // Parse buffer.
+        _NEOM8X_parse_nmea_gga(&nmea_sentence, &gps_position, &gps_position_e7, &fix_quality, &decode_success_flag);
+        _NEOM8X_process_position(&gps_position, &gps_position_e7, &fix_quality, decode_success_flag);
+        break;
+#endif
+#if ((defined NEOM8X_DRIVER_GPS_DATA_TIME) || (defined NEOM8X_DRIVER_GPS_DATA_POSITION))
+    case NEOM8X_NMEA_MESSAGE_INDEX_RMC:
+        // RMC message contains both date, time and horizontal position.
+#ifdef NEOM8X_DRIVER_GPS_DATA_TIME
+        if ((neom8x_ctx.acquisition.gps_data & NEOM8X_GPS_DATA_TIME) != 0) {
+            // Parse buffer.
+            _NEOM8X_parse_nmea_rmc_time(&nmea_sentence, &gps_time, &decode_success_flag);
+            // Check decoding result.
+            if (decode_success_flag != 0) {
+                _NEOM8X_update_time(&gps_time, &acquisition_status);
+                neom8x_ctx.acquisition.completion_callback(NEOM8X_GPS_DATA_TIME, acquisition_status);
+            }
+        }
+#endif
+#ifdef NEOM8X_DRIVER_GPS_DATA_POSITION
+        if ((neom8x_ctx.acquisition.gps_data & NEOM8X_GPS_DATA_POSITION) != 0) {
+            // Parse buffer.
+            _NEOM8X_parse_nmea_rmc_position(&nmea_sentence, &gps_position, &decode_success_flag);
+            _NEOM8X_parse_nmea_rmc_fix_quality(&nmea_sentence, &fix_quality);
+            // Altitude is not provided by RMC message.
+            _NEOM8X_convert_position_e7(&gps_position, &gps_position_e7);
+            gps_position_e7.altitude_mm = 0;
+            _NEOM8X_process_position(&gps_position, &gps_position_e7, &fix_quality, decode_success_flag);
+        }
+#endif
+        break;
+#endif
+    default:
+        // Message not used by the driver.
+        break;
+    }
+errors:
+    return status;
+}
+
+#ifdef NEOM8X_DRIVER_UBX_NAV_PVT
+/*******************************************************************/
+static NEOM8X_status_t _NEOM8X_process_ubx_frame(uint8_t* ubx_rx_buf) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    uint8_t* ubx_nav_pvt = &(ubx_rx_buf[NEOM8X_UBX_PAYLOAD_OFFSET]);
+    uint8_t decode_success_flag = 0;
+#ifdef NEOM8X_DRIVER_GPS_DATA_TIME
+    NEOM8X_acquisition_status_t acquisition_status = NEOM8X_ACQUISITION_STATUS_FAIL;
+    NEOM8X_time_t gps_time;
+#endif
+#ifdef NEOM8X_DRIVER_GPS_DATA_POSITION
+    NEOM8X_position_t gps_position;
+    NEOM8X_position_e7_t gps_position_e7;
+    NEOM8X_fix_quality_t fix_quality;
+#endif
+    // NAV-PVT message (only message buffered by the reception state machine) contains all data.
+#ifdef NEOM8X_DRIVER_GPS_DATA_TIME
+    if ((neom8x_ctx.acquisition.gps_data & NEOM8X_GPS_DATA_TIME) != 0) {
+        // Parse buffer.
+        acquisition_status = NEOM8X_ACQUISITION_STATUS_FAIL;
+        _NEOM8X_reset_time(&gps_time);
+        _NEOM8X_parse_ubx_nav_pvt_time(ubx_nav_pvt, &gps_time, &decode_success_flag);
+        // Check decoding result.
+        if (decode_success_flag != 0) {
+            _NEOM8X_update_time(&gps_time, &acquisition_status);
+            neom8x_ctx.acquisition.completion_callback(NEOM8X_GPS_DATA_TIME, acquisition_status);
+        }
+    }
+#endif
+#ifdef NEOM8X_DRIVER_GPS_DATA_POSITION
+    if ((neom8x_ctx.acquisition.gps_data & NEOM8X_GPS_DATA_POSITION) != 0) {
+        // Parse buffer.
+        _NEOM8X_reset_position(&gps_position);
+        _NEOM8X_parse_ubx_nav_pvt_position(ubx_nav_pvt, &gps_position, &gps_position_e7, &fix_quality, &decode_success_flag);
+        _NEOM8X_process_position(&gps_position, &gps_position_e7, &fix_quality, decode_success_flag);
+    }
+#endif
+    return status;
+}
+#endif
+
+/*** NEOM8X functions ***/
+
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_init(void) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    uint8_t buffer_idx = 0;
+    uint32_t idx = 0;
+    // Init context.
+    for (buffer_idx = 0; buffer_idx < NEOM8X_RX_BUFFER_DEPTH; buffer_idx++) {
+        for (idx = 0; idx < NEOM8X_RX_BUFFER_SIZE_BYTES; idx++)
+            neom8x_ctx.rx_buffer[buffer_idx][idx] = 0;
+    }
+    neom8x_ctx.rx_write_idx = 0;
+    neom8x_ctx.rx_read_idx = 0;
+    neom8x_ctx.rx_char_idx = 0;
+    neom8x_ctx.rx_state = NEOM8X_RX_STATE_IDLE;
+    neom8x_ctx.nmea_message_mask = 0;
+#ifdef NEOM8X_DRIVER_SENTENCE_VIEW
+    neom8x_ctx.sentence_view_mask = 0;
+    neom8x_ctx.sentence_view_callback = NULL;
+#endif
+    neom8x_ctx.ubx_ack_received_flag = 0;
+#ifdef NEOM8X_DRIVER_UBX_NAV_PVT
+    neom8x_ctx.ubx_nav_pvt_subscribed_flag = 0;
+#endif
+#ifdef NEOM8X_DRIVER_UBX_MGA
+    neom8x_ctx.mga_ack_received_flag = 0;
+#endif
+#ifdef NEOM8X_DRIVER_UBX_SOS
+    neom8x_ctx.sos_response_received_flag = 0;
+    neom8x_ctx.backup_restore_status = NEOM8X_BACKUP_RESTORE_STATUS_UNKNOWN;
+    neom8x_ctx.gnss_stopped_flag = 0;
+#endif
+    neom8x_ctx.uart_baud_rate = NEOM8X_UART_BAUD_RATE_DEFAULT;
+    neom8x_ctx.requested_uart_baud_rate = NEOM8X_UART_BAUD_RATE_DEFAULT;
+    neom8x_ctx.baud_rate_switch_state = NEOM8X_BAUD_RATE_SWITCH_STATE_IDLE;
+    neom8x_ctx.baud_rate_fallback_flag = 0;
+    neom8x_ctx.configuration.nmea_message_mask = 0;
+    neom8x_ctx.configuration.port_output_protocol_mask = (NEOM8X_UBX_PROTOCOL_UBX | NEOM8X_UBX_PROTOCOL_NMEA);
+    neom8x_ctx.configuration.measurement_period_ms = NEOM8X_MEASUREMENT_PERIOD_DEFAULT_MS;
+#ifdef NEOM8X_DRIVER_UBX_NAV_PVT
+    neom8x_ctx.configuration.ubx_nav_pvt_rate = 0;
+#endif
+#ifdef NEOM8X_DRIVER_POWER_SAVE
+    neom8x_ctx.configuration.power_save_mode = NEOM8X_POWER_MODE_CONTINUOUS;
+    neom8x_ctx.configuration.power_save_period_ms = 0;
+    neom8x_ctx.configuration.low_power_flag = 0;
+    neom8x_ctx.module_sleeping_flag = 0;
+    neom8x_ctx.acquisition.power_mode = NEOM8X_POWER_MODE_CONTINUOUS;
+    neom8x_ctx.acquisition.sleep_on_stop = 0;
+#endif
+    neom8x_ctx.configuration_step = NEOM8X_CONFIGURATION_STEP_LAST;
+    neom8x_ctx.configuration_retry_count = 0;
+    neom8x_ctx.timer_irq_flag = 0;
+    neom8x_ctx.known_configuration_mask = 0;
+    neom8x_ctx.module_reset_detected_flag = 0;
+    _NEOM8X_reset_statistics();
+    neom8x_ctx.acquisition.gps_data = NEOM8X_GPS_DATA_NONE;
+    neom8x_ctx.acquisition.mode = NEOM8X_ACQUISITION_MODE_NMEA;
+    neom8x_ctx.acquisition.process_callback = NULL;
+    neom8x_ctx.acquisition.completion_callback = NULL;
+    neom8x_ctx.acquisition_started_flag = 0;
+    // Init hardware interface.
+    status = _NEOM8X_init_hw();
+    if (status != NEOM8X_SUCCESS) goto errors;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_de_init(void) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    // Release hardware interface.
+    status = NEOM8X_HW_de_init();
+    if (status != NEOM8X_SUCCESS) goto errors;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_start_acquisition(NEOM8X_acquisition_t* acquisition) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    // Check state.
+    if (neom8x_ctx.acquisition.gps_data != NEOM8X_GPS_DATA_NONE) {
+        status = NEOM8X_ERROR_ACQUISITION_RUNNING;
+        goto errors;
+    }
+    // Check parameters.
+    if (acquisition == NULL) {
+        status = NEOM8X_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (((acquisition->process_callback) == NULL) || ((acquisition->completion_callback) == NULL)) {
+        status = NEOM8X_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (((acquisition->measurement_period_ms) != 0) && ((acquisition->measurement_period_ms) < NEOM8X_MEASUREMENT_PERIOD_MIN_MS)) {
+        status = NEOM8X_ERROR_MEASUREMENT_PERIOD;
+        goto errors;
+    }
+    // Flush reception buffer.
+    neom8x_ctx.rx_state = NEOM8X_RX_STATE_IDLE;
+    neom8x_ctx.rx_read_idx = neom8x_ctx.rx_write_idx;
+#if ((defined NEOM8X_DRIVER_GPS_DATA_POSITION) && (NEOM8X_DRIVER_ALTITUDE_STABILITY_FILTER_MODE > 0))
+    _NEOM8X_reset_stability_window();
+#endif
+    // Copy acquisition parameters locally.
+    neom8x_ctx.acquisition.gps_data = (acquisition->gps_data);
+    neom8x_ctx.acquisition.completion_callback = (acquisition->completion_callback);
+    neom8x_ctx.acquisition.process_callback = (acquisition->process_callback);
+    neom8x_ctx.acquisition.mode = (acquisition->mode);
+#if ((defined NEOM8X_DRIVER_GPS_DATA_POSITION) && (NEOM8X_DRIVER_ALTITUDE_STABILITY_FILTER_MODE == 2))
+    neom8x_ctx.acquisition.altitude_stability_threshold = (acquisition->altitude_stability_threshold);
+    neom8x_ctx.acquisition.horizontal_stability_threshold_m = (acquisition->horizontal_stability_threshold_m);
+    neom8x_ctx.acquisition.vertical_stability_threshold_m = (acquisition->vertical_stability_threshold_m);
+#endif
+#ifdef NEOM8X_DRIVER_GPS_DATA_POSITION
+    neom8x_ctx.acquisition.fix_indicator_min = (acquisition->fix_indicator_min);
+    neom8x_ctx.acquisition.satellites_min = (acquisition->satellites_min);
+    neom8x_ctx.acquisition.hdop_max = (acquisition->hdop_max);
+    neom8x_ctx.acquisition.timeout_ms = (acquisition->timeout_ms);
+#endif
+#ifdef NEOM8X_DRIVER_POWER_SAVE
+    neom8x_ctx.acquisition.power_mode = (acquisition->power_mode);
+    neom8x_ctx.acquisition.power_save_period_ms = (acquisition->power_save_period_ms);
+    neom8x_ctx.acquisition.sleep_on_stop = (acquisition->sleep_on_stop);
+#endif
+    // Check requested data.
+    if ((neom8x_ctx.acquisition.gps_data == NEOM8X_GPS_DATA_NONE) || ((neom8x_ctx.acquisition.gps_data & (~NEOM8X_GPS_DATA_SUPPORTED_MASK)) != 0)) {
+        neom8x_ctx.acquisition.gps_data = NEOM8X_GPS_DATA_NONE;
+        status = NEOM8X_ERROR_ACQUISITION_DATA;
+        goto errors;
+    }
+    // Select NMEA messages.
+    neom8x_ctx.nmea_message_mask = 0;
+#ifdef NEOM8X_DRIVER_GPS_DATA_TIME
+    if ((neom8x_ctx.acquisition.gps_data & NEOM8X_GPS_DATA_TIME) != 0) {
+        // Reset structure.
+        _NEOM8X_reset_time(&(neom8x_ctx.gps_time));
+        // Select ZDA message to get complete date and time.
+        neom8x_ctx.nmea_message_mask |= (0b1 << NEOM8X_NMEA_MESSAGE_INDEX_ZDA);
+    }
+#endif
+#ifdef NEOM8X_DRIVER_GPS_DATA_POSITION
+    if ((neom8x_ctx.acquisition.gps_data & NEOM8X_GPS_DATA_POSITION) != 0) {
+        // Check fix quality gate.
+        if (neom8x_ctx.acquisition.fix_indicator_min >= NEOM8X_FIX_INDICATOR_LAST) {
+            neom8x_ctx.acquisition.gps_data = NEOM8X_GPS_DATA_NONE;
+            status = NEOM8X_ERROR_FIX_INDICATOR;
+            goto errors;
+        }
+#if (NEOM8X_DRIVER_ALTITUDE_STABILITY_FILTER_MODE == 2)
+        // Check stability window size.
+        if (neom8x_ctx.acquisition.altitude_stability_threshold > NEOM8X_STABILITY_WINDOW_SIZE_MAX) {
+            neom8x_ctx.acquisition.gps_data = NEOM8X_GPS_DATA_NONE;
+            status = NEOM8X_ERROR_STABILITY_THRESHOLD;
+            goto errors;
+        }
+#endif
+        // Reset structures.
+        _NEOM8X_reset_position(&(neom8x_ctx.gps_position));
+        _NEOM8X_reset_position_e7(&(neom8x_ctx.gps_position_e7));
+        _NEOM8X_reset_fix_quality(&(neom8x_ctx.fix_quality));
+        neom8x_ctx.position_status = NEOM8X_ACQUISITION_STATUS_FAIL;
+        neom8x_ctx.position_epoch_count = 0;
+        neom8x_ctx.position_abort_flag = 0;
+        neom8x_ctx.sky_trend_epoch_count = 0;
+        // Select GGA message to get complete position.
+        neom8x_ctx.nmea_message_mask |= (0b1 << NEOM8X_NMEA_MESSAGE_INDEX_GGA);
+    }
+#endif
+    // Set receiver configuration.
+    neom8x_ctx.configuration.port_output_protocol_mask = (NEOM8X_UBX_PROTOCOL_UBX | NEOM8X_UBX_PROTOCOL_NMEA);
+    neom8x_ctx.configuration.measurement_period_ms = (acquisition->measurement_period_ms == 0) ? NEOM8X_MEASUREMENT_PERIOD_DEFAULT_MS : (acquisition->measurement_period_ms);
+#ifdef NEOM8X_DRIVER_UBX_NAV_PVT
+    neom8x_ctx.configuration.ubx_nav_pvt_rate = 0;
+    neom8x_ctx.ubx_nav_pvt_subscribed_flag = 0;
+#endif
+    switch (neom8x_ctx.acquisition.mode) {
+    case NEOM8X_ACQUISITION_MODE_NMEA:
+        break;
+    case NEOM8X_ACQUISITION_MODE_NMEA_RMC:
+        // Select RMC message only since it contains both date, time and horizontal position.
+        neom8x_ctx.nmea_message_mask = (0b1 << NEOM8X_NMEA_MESSAGE_INDEX_RMC);
+        break;
+#ifdef NEOM8X_DRIVER_UBX_NAV_PVT
+    case NEOM8X_ACQUISITION_MODE_UBX_NAV_PVT:
+        // Disable NMEA output and enable NAV-PVT message instead.
+        neom8x_ctx.nmea_message_mask = 0;
+        neom8x_ctx.configuration.port_output_protocol_mask = NEOM8X_UBX_PROTOCOL_UBX;
+        neom8x_ctx.configuration.ubx_nav_pvt_rate = 1;
+        neom8x_ctx.ubx_nav_pvt_subscribed_flag = 1;
+        break;
+#endif
+    default:
+        neom8x_ctx.acquisition.gps_data = NEOM8X_GPS_DATA_NONE;
+        status = NEOM8X_ERROR_ACQUISITION_MODE;
+        goto errors;
+    }
+    neom8x_ctx.configuration.nmea_message_mask = neom8x_ctx.nmea_message_mask;
+#ifdef NEOM8X_DRIVER_POWER_SAVE
+    // Select power mode.
+    if (neom8x_ctx.acquisition.power_mode >= NEOM8X_POWER_MODE_LAST) {
+        neom8x_ctx.acquisition.gps_data = NEOM8X_GPS_DATA_NONE;
+        status = NEOM8X_ERROR_POWER_MODE;
+        goto errors;
+    }
+    neom8x_ctx.configuration.low_power_flag = (neom8x_ctx.acquisition.power_mode == NEOM8X_POWER_MODE_CONTINUOUS) ? 0 : 1;
+    if (neom8x_ctx.configuration.low_power_flag != 0) {
+        neom8x_ctx.configuration.power_save_mode = neom8x_ctx.acquisition.power_mode;
+        neom8x_ctx.configuration.power_save_period_ms = (neom8x_ctx.acquisition.power_save_period_ms == 0) ? neom8x_ctx.configuration.measurement_period_ms : neom8x_ctx.acquisition.power_save_period_ms;
+        if (neom8x_ctx.configuration.power_save_period_ms < NEOM8X_POWER_SAVE_PERIOD_MIN_MS) {
+            neom8x_ctx.acquisition.gps_data = NEOM8X_GPS_DATA_NONE;
+            status = NEOM8X_ERROR_POWER_SAVE_PERIOD;
+            goto errors;
+        }
+    }
+#endif
+#ifdef NEOM8X_DRIVER_SENTENCE_VIEW
+    // Enable subscribed sentences on top of the driver ones (NMEA output is kept in UBX mode).
+    if (neom8x_ctx.sentence_view_mask != 0) {
+        neom8x_ctx.configuration.nmea_message_mask |= neom8x_ctx.sentence_view_mask;
+        neom8x_ctx.configuration.port_output_protocol_mask |= NEOM8X_UBX_PROTOCOL_NMEA;
+    }
+#endif
+    // Start frames reception (the module is released by the next stop whatever the acquisition result).
+    neom8x_ctx.acquisition_started_flag = 1;
+    status = NEOM8X_HW_start_rx();
+    if (status != NEOM8X_SUCCESS) goto errors;
+#ifdef NEOM8X_DRIVER_POWER_SAVE
+    // Wake-up module if it has been put in backup mode.
+    if (neom8x_ctx.module_sleeping_flag != 0) {
+        status = _NEOM8X_wake_up();
+        if (status != NEOM8X_SUCCESS) goto errors;
+    }
+#endif
+#ifdef NEOM8X_DRIVER_UBX_SOS
+    // Restart GNSS if it has been stopped by a shutdown without power cycle (no effect on a running receiver).
+    if (neom8x_ctx.gnss_stopped_flag != 0) {
+        status = _NEOM8X_send_gnss_reset(NEOM8X_UBX_CFG_RST_MODE_GNSS_START);
+        if (status != NEOM8X_SUCCESS) goto errors;
+        neom8x_ctx.gnss_stopped_flag = 0;
+    }
+    // Poll the navigation backup restore status if the boot message of the module has not been received (after the baud rate switch if any).
+    if ((neom8x_ctx.backup_restore_status == NEOM8X_BACKUP_RESTORE_STATUS_UNKNOWN) && (neom8x_ctx.requested_uart_baud_rate == neom8x_ctx.uart_baud_rate)) {
+        status = _NEOM8X_poll_backup_restore_status();
+        if (status != NEOM8X_SUCCESS) goto errors;
+    }
+#endif
+    // Start configuration pipeline (next commands are sent by the process function on acknowledge).
+    status = _NEOM8X_start_configuration();
+    if (status != NEOM8X_SUCCESS) goto errors;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_stop_acquisition(void) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    // Directly exit if the module has not been started since the last stop.
+    if (neom8x_ctx.acquisition_started_flag == 0) goto errors;
+    // Release driver.
+    neom8x_ctx.acquisition.gps_data = NEOM8X_GPS_DATA_NONE;
+    neom8x_ctx.nmea_message_mask = 0;
+#ifdef NEOM8X_DRIVER_UBX_NAV_PVT
+    neom8x_ctx.ubx_nav_pvt_subscribed_flag = 0;
+#endif
+    // Abort configuration pipeline.
+    neom8x_ctx.configuration_step = NEOM8X_CONFIGURATION_STEP_LAST;
+    neom8x_ctx.baud_rate_switch_state = NEOM8X_BAUD_RATE_SWITCH_STATE_IDLE;
+    status = NEOM8X_HW_stop_timer();
+    if (status != NEOM8X_SUCCESS) goto errors;
+    // Stop frames reception.
+    status = NEOM8X_HW_stop_rx();
+    if (status != NEOM8X_SUCCESS) goto errors;
+#ifdef NEOM8X_DRIVER_POWER_SAVE
+    // Put module in backup mode until next acquisition (output is stopped as well).
+    if (neom8x_ctx.acquisition.sleep_on_stop != 0) {
+        if (neom8x_ctx.module_sleeping_flag == 0) {
+            status = _NEOM8X_enter_backup_mode();
+            if (status != NEOM8X_SUCCESS) goto errors;
+        }
+        neom8x_ctx.acquisition_started_flag = 0;
+        goto errors;
+    }
+#endif
+    // Silence module output until next acquisition (the next start restores the changed settings).
+    status = _NEOM8X_disable_output();
+    if (status != NEOM8X_SUCCESS) goto errors;
+    neom8x_ctx.acquisition_started_flag = 0;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_process(void) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    char_t* rx_frame = NULL;
+    // Step configuration pipeline.
+    status = _NEOM8X_process_configuration();
+    if (status != NEOM8X_SUCCESS) goto errors;
+    // Process all pending frames.
+    while (neom8x_ctx.rx_read_idx != neom8x_ctx.rx_write_idx) {
+        // Decode frame.
+        rx_frame = (char_t*) neom8x_ctx.rx_buffer[neom8x_ctx.rx_read_idx & NEOM8X_RX_BUFFER_INDEX_MASK];
+#ifdef NEOM8X_DRIVER_UBX_NAV_PVT
+        if (((uint8_t) rx_frame[0]) == NEOM8X_UBX_SYNC_CHAR_1) {
+            status = _NEOM8X_process_ubx_frame((uint8_t*) rx_frame);
+        }
+        else
+#endif
+        status = _NEOM8X_process_nmea_frame(rx_frame);
+        // Release slot.
+        neom8x_ctx.rx_read_idx++;
+        if (status != NEOM8X_SUCCESS) goto errors;
     }
 errors:
-    return;
+    return status;
+}
+
+#ifdef NEOM8X_DRIVER_GPS_DATA_TIME
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_get_time(NEOM8X_time_t* gps_time) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    // Check parameter.
+    if (gps_time == NULL) {
+        status = NEOM8X_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Copy data.
+    _NEOM8X_copy_time(&(neom8x_ctx.gps_time), gps_time);
+errors:
+    return status;
 }
 #endif
 
+#ifdef NEOM8X_DRIVER_GPS_DATA_POSITION
 /*******************************************************************/
-static NEOM8X_status_t _NEOM8X_select_nmea_messages(uint32_t nmea_message_id_mask) {
+NEOM8X_status_t NEOM8X_get_position(NEOM8X_position_t* gps_position) {
     // Local variables.
     NEOM8X_status_t status = NEOM8X_SUCCESS;
-    // See p.110 for NMEA messages ID.
-    uint8_t nmea_message_id[NEOM8X_NMEA_MESSAGE_INDEX_LAST] = {
-        0x0A, // DTM.
-        0x44, // GBQ.
-        0x09, // GBS.
-        0x00, // GGA.
-        0x01, // GLL.
-        0x43, // GLQ.
-        0x42, // GNQ.
-        0x0D, // GNS.
-        0x40, // GPQ.
-        0x06, // GRS.
-        0x02, // GSA.
-        0x07, // GST.
-        0x03, // GSV.
-        0x04, // RMC.
-        0x41, // TXT.
-        0x0F, // VLW.
-        0x05, // VTG.
-        0x08  // ZDA.
-    };
-    // See p.174 for UBX message format.
-    uint8_t ubx_cfg_msg[NEOM8X_UBX_MSG_OVERHEAD_SIZE_BYTES + NEOM8X_UBX_CFG_MSG_PAYLOAD_SIZE_BYTES] = {
-        0xB5, 0x62,                                   // Preamble.
-        0x06, 0x01,                                   // UBX message class and ID.
-        NEOM8X_UBX_CFG_MSG_PAYLOAD_SIZE_BYTES, 0x00,  // Length.
-        0xF0, 0x00,                                   // NMEA message class and ID.
-        0, 0, 0, 0, 0, 0,                             // Message rate on each port.
-        0x00, 0x00                                    // UBX checksum.
-    };
-    uint8_t nmea_idx = 0;
-    uint8_t idx = 0;
-    // Send commands.
-    for (nmea_idx = 0; nmea_idx < NEOM8X_NMEA_MESSAGE_INDEX_LAST; nmea_idx++) {
-        // Byte 7 = ID of the message to enable or disable.
-        ubx_cfg_msg[7] = nmea_message_id[nmea_idx];
-        // Bytes 8-13 = message rate.
-        for (idx = 8; idx < 14; idx++) {
-            ubx_cfg_msg[idx] = ((nmea_message_id_mask & (0b1 << nmea_idx)) != 0) ? 1 : 0;
-        }
-        // Bytes 14-15 = UBX checksum (CK_A and CK_B).
-        _NEOM8X_compute_ubx_checksum(ubx_cfg_msg, NEOM8X_UBX_CFG_MSG_PAYLOAD_SIZE_BYTES);
-        // Send message.
-        status = NEOM8X_HW_send_message(ubx_cfg_msg, (NEOM8X_UBX_MSG_OVERHEAD_SIZE_BYTES + NEOM8X_UBX_CFG_MSG_PAYLOAD_SIZE_BYTES));
-        if (status != NEOM8X_SUCCESS) goto errors;
-        // Delay between messages.
-        status = NEOM8X_HW_delay_milliseconds(100);
-        if (status != NEOM8X_SUCCESS) goto errors;
+    // Check parameters.
+    if (gps_position == NULL) {
+        status = NEOM8X_ERROR_NULL_PARAMETER;
+        goto errors;
     }
+    // Copy data.
+    _NEOM8X_copy_position(&(neom8x_ctx.gps_position), gps_position);
 errors:
     return status;
 }
 
-/*** NEOM8X functions ***/
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_get_position_extended(NEOM8X_position_extended_t* gps_position_extended) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    // Check parameters.
+    if (gps_position_extended == NULL) {
+        status = NEOM8X_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Copy data.
+    _NEOM8X_copy_position(&(neom8x_ctx.gps_position), &(gps_position_extended->position));
+    _NEOM8X_copy_fix_quality(&(neom8x_ctx.fix_quality), &(gps_position_extended->fix_quality));
+errors:
+    return status;
+}
 
 /*******************************************************************/
-NEOM8X_status_t NEOM8X_init(void) {
+NEOM8X_status_t NEOM8X_get_position_e7(NEOM8X_position_e7_t* gps_position_e7) {
     // Local variables.
     NEOM8X_status_t status = NEOM8X_SUCCESS;
-    NEOM8X_HW_configuration_t hw_config;
-    uint8_t buffer_idx = 0;
-    uint32_t idx = 0;
-    // Init context.
-    for (buffer_idx = 0; buffer_idx < NEOM8X_NMEA_RX_BUFFER_DEPTH; buffer_idx++) {
-        for (idx = 0; idx < NEOM8X_NMEA_RX_BUFFER_SIZE_BYTES; idx++)
-            neom8x_ctx.nmea_buffer[buffer_idx][idx] = 0;
+    // Check parameters.
+    if (gps_position_e7 == NULL) {
+        status = NEOM8X_ERROR_NULL_PARAMETER;
+        goto errors;
     }
-    neom8x_ctx.nmea_buffer_idx_write = 0;
-    neom8x_ctx.nmea_buffer_idx_ready = 0;
-    neom8x_ctx.nmea_frame_received_flag = 0;
-    neom8x_ctx.acquisition.gps_data = NEOM8X_GPS_DATA_NONE;
-    neom8x_ctx.acquisition.process_callback = NULL;
-    neom8x_ctx.acquisition.completion_callback = NULL;
-    // Init hardware interface.
-    hw_config.uart_baud_rate = NEOM8X_UART_BAUD_RATE;
-    hw_config.rx_irq_callback = &_NEOM8X_rx_irq_callback;
-    status = NEOM8X_HW_init(&hw_config);
-    if (status != NEOM8X_SUCCESS) goto errors;
+    // Copy data.
+    _NEOM8X_copy_position_e7(&(neom8x_ctx.gps_position_e7), gps_position_e7);
 errors:
     return status;
 }
+#endif
 
 /*******************************************************************/
-NEOM8X_status_t NEOM8X_de_init(void) {
+NEOM8X_status_t NEOM8X_get_statistics(NEOM8X_statistics_t* statistics) {
     // Local variables.
     NEOM8X_status_t status = NEOM8X_SUCCESS;
-    // Release hardware interface.
-    status = NEOM8X_HW_de_init();
-    if (status != NEOM8X_SUCCESS) goto errors;
+    // Check parameter.
+    if (statistics == NULL) {
+        status = NEOM8X_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Copy counters.
+    (statistics->rx_byte_count) = neom8x_ctx.statistics.rx_byte_count;
+    (statistics->frame_count) = neom8x_ctx.statistics.frame_count;
+    (statistics->buffer_overflow_count) = neom8x_ctx.statistics.buffer_overflow_count;
+    (statistics->frame_dropped_count) = neom8x_ctx.statistics.frame_dropped_count;
+    (statistics->checksum_error_count) = neom8x_ctx.statistics.checksum_error_count;
+    (statistics->field_size_error_count) = neom8x_ctx.statistics.field_size_error_count;
+    (statistics->data_validity_error_count) = neom8x_ctx.statistics.data_validity_error_count;
 errors:
     return status;
 }
 
 /*******************************************************************/
-NEOM8X_status_t NEOM8X_start_acquisition(NEOM8X_acquisition_t* acquisition) {
+NEOM8X_status_t NEOM8X_reset_statistics(void) {
+    // Reset counters.
+    _NEOM8X_reset_statistics();
+    return NEOM8X_SUCCESS;
+}
+
+#ifdef NEOM8X_DRIVER_SENTENCE_VIEW
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_set_sentence_subscription(uint32_t nmea_message_mask, NEOM8X_sentence_cb_t sentence_callback) {
     // Local variables.
     NEOM8X_status_t status = NEOM8X_SUCCESS;
-    // Check state.
+    // Check state (the receiver configuration is only computed when starting an acquisition).
     if (neom8x_ctx.acquisition.gps_data != NEOM8X_GPS_DATA_NONE) {
         status = NEOM8X_ERROR_ACQUISITION_RUNNING;
         goto errors;
     }
-    // Reset context.
-    neom8x_ctx.nmea_frame_received_flag = 0;
-#if ((defined NEOM8X_DRIVER_GPS_DATA_POSITION) && (NEOM8X_DRIVER_ALTITUDE_STABILITY_FILTER_MODE > 0))
-    neom8x_ctx.same_altitude_count = 0;
-    neom8x_ctx.previous_altitude = 0;
-#endif
     // Check parameters.
-    if (acquisition == NULL) {
+    if ((nmea_message_mask != 0) && (sentence_callback == NULL)) {
         status = NEOM8X_ERROR_NULL_PARAMETER;
         goto errors;
     }
-    if (((acquisition->process_callback) == NULL) || ((acquisition->completion_callback) == NULL)) {
+    // Update subscription.
+    neom8x_ctx.sentence_view_mask = (nmea_message_mask & ((0b1 << NEOM8X_NMEA_MESSAGE_INDEX_LAST) - 1));
+    neom8x_ctx.sentence_view_callback = sentence_callback;
+errors:
+    return status;
+}
+#endif
+
+#ifdef NEOM8X_DRIVER_SENTENCE_VIEW
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_get_sentence_field(const NEOM8X_sentence_view_t* sentence_view, uint8_t field_index, const char_t** field, uint8_t* field_size_bytes) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    // Check parameters.
+    if ((sentence_view == NULL) || (field == NULL) || (field_size_bytes == NULL)) {
         status = NEOM8X_ERROR_NULL_PARAMETER;
         goto errors;
     }
-    // Copy acquisition parameters locally.
-    neom8x_ctx.acquisition.gps_data = (acquisition->gps_data);
-    neom8x_ctx.acquisition.completion_callback = (acquisition->completion_callback);
-    neom8x_ctx.acquisition.process_callback = (acquisition->process_callback);
-#if ((defined NEOM8X_DRIVER_GPS_DATA_POSITION) && (NEOM8X_DRIVER_ALTITUDE_STABILITY_FILTER_MODE == 2))
-    neom8x_ctx.acquisition.altitude_stability_threshold = (acquisition->altitude_stability_threshold);
-#endif
-    // Select NMEA messages.
-    switch (neom8x_ctx.acquisition.gps_data) {
-#ifdef NEOM8X_DRIVER_GPS_DATA_TIME
-    case NEOM8X_GPS_DATA_TIME:
-        // Reset structure.
-        _NEOM8X_reset_time(&(neom8x_ctx.gps_time));
-        // Select ZDA message to get complete date and time.
-        status = _NEOM8X_select_nmea_messages(0b1 << NEOM8X_NMEA_MESSAGE_INDEX_ZDA);
-        if (status != NEOM8X_SUCCESS) goto errors;
-        break;
-#endif
-#ifdef NEOM8X_DRIVER_GPS_DATA_POSITION
-    case NEOM8X_GPS_DATA_POSITION:
-        // Reset structure.
-        _NEOM8X_reset_position(&(neom8x_ctx.gps_position));
-        // Select GGA message to get complete position.
-        status = _NEOM8X_select_nmea_messages(0b1 << NEOM8X_NMEA_MESSAGE_INDEX_GGA);
-        if (status != NEOM8X_SUCCESS) goto errors;
-        break;
+    if (field_index >= (sentence_view->number_of_fields)) {
+        status = NEOM8X_ERROR_SENTENCE_FIELD_INDEX;
+        goto errors;
+    }
+    // Field ends one character before the next field offset (separator or checksum start).
+    (*field) = &((sentence_view->sentence)[(sentence_view->field_offset)[field_index]]);
+    (*field_size_bytes) = (uint8_t) ((sentence_view->field_offset)[field_index + 1] - (sentence_view->field_offset)[field_index] - 1);
+errors:
+    return status;
+}
 #endif
-    default:
-        status = NEOM8X_ERROR_ACQUISITION_DATA;
+
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_set_baud_rate(uint32_t baud_rate) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    // Check parameter.
+    if ((baud_rate < NEOM8X_UART_BAUD_RATE_MIN) || (baud_rate > NEOM8X_UART_BAUD_RATE_MAX)) {
+        status = NEOM8X_ERROR_BAUD_RATE;
         goto errors;
     }
-    // Start NMEA frames reception.
-    status = NEOM8X_HW_start_rx();
-    if (status != NEOM8X_SUCCESS) goto errors;
+    // Check state.
+    if (neom8x_ctx.acquisition.gps_data != NEOM8X_GPS_DATA_NONE) {
+        status = NEOM8X_ERROR_ACQUISITION_RUNNING;
+        goto errors;
+    }
+    // Switch is performed by the configuration pipeline of the next acquisition.
+    neom8x_ctx.requested_uart_baud_rate = baud_rate;
 errors:
     return status;
 }
 
 /*******************************************************************/
-NEOM8X_status_t NEOM8X_stop_acquisition(void) {
+NEOM8X_status_t NEOM8X_get_baud_rate(uint32_t* baud_rate) {
     // Local variables.
     NEOM8X_status_t status = NEOM8X_SUCCESS;
-    // Release driver.
-    neom8x_ctx.acquisition.gps_data = NEOM8X_GPS_DATA_NONE;
-    // Stop NMEA frames reception.
-    status = NEOM8X_HW_stop_rx();
-    if (status != NEOM8X_SUCCESS) goto errors;
+    // Check parameter.
+    if (baud_rate == NULL) {
+        status = NEOM8X_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    (*baud_rate) = neom8x_ctx.uart_baud_rate;
 errors:
     return status;
 }
 
+#ifdef NEOM8X_DRIVER_UBX_MGA
 /*******************************************************************/
-NEOM8X_status_t NEOM8X_process(void) {
+NEOM8X_status_t NEOM8X_inject_aiding_time(NEOM8X_time_t* utc_time, uint16_t time_accuracy_seconds) {
     // Local variables.
     NEOM8X_status_t status = NEOM8X_SUCCESS;
-    NEOM8X_acquisition_status_t acquisition_status = NEOM8X_ACQUISITION_STATUS_FAIL;
-    uint8_t decode_success_flag = 0;
-#ifdef NEOM8X_DRIVER_GPS_DATA_TIME
-    NEOM8X_time_t gps_time;
-#endif
-#ifdef NEOM8X_DRIVER_GPS_DATA_POSITION
-    NEOM8X_position_t gps_position;
-#endif
-    // Check flag.
-    if (neom8x_ctx.nmea_frame_received_flag == 0) goto errors;
-    // Clear flag.
-    neom8x_ctx.nmea_frame_received_flag = 0;
-    // Reset structures.
-#ifdef NEOM8X_DRIVER_GPS_DATA_TIME
-    _NEOM8X_reset_time(&gps_time);
+    // See MGA-INI-TIME_UTC section for UBX message format.
+    uint8_t ubx_mga_ini_time_utc[NEOM8X_UBX_MSG_OVERHEAD_SIZE_BYTES + NEOM8X_UBX_MGA_INI_TIME_UTC_SIZE_BYTES] = {
+        0xB5, 0x62,                                     // Preamble.
+        NEOM8X_UBX_CLASS_MGA, NEOM8X_UBX_ID_MGA_INI,    // UBX message class and ID.
+        NEOM8X_UBX_MGA_INI_TIME_UTC_SIZE_BYTES, 0x00,   // Length.
+        0x10,                                           // Type (UTC time).
+        0x00,                                           // Version.
+        0x00,                                           // Time reference (on message reception).
+        0x80,                                           // Leap seconds (unknown).
+        0, 0, 0, 0,                                     // Year, month and day.
+        0, 0, 0,                                        // Hours, minutes and seconds.
+        0x00,                                           // Reserved.
+        0x00, 0x00, 0x00, 0x00,                         // Nanoseconds.
+        0, 0,                                           // Seconds part of time accuracy.
+        0x00, 0x00,                                     // Reserved.
+        0x00, 0x00, 0x00, 0x00,                         // Nanoseconds part of time accuracy.
+        0x00, 0x00                                      // UBX checksum.
+    };
+    // Check parameters.
+    if (utc_time == NULL) {
+        status = NEOM8X_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Date and time.
+    ubx_mga_ini_time_utc[10] = (uint8_t) ((utc_time->year) >> 0);
+    ubx_mga_ini_time_utc[11] = (uint8_t) ((utc_time->year) >> 8);
+    ubx_mga_ini_time_utc[12] = (utc_time->month);
+    ubx_mga_ini_time_utc[13] = (utc_time->date);
+    ubx_mga_ini_time_utc[14] = (utc_time->hours);
+    ubx_mga_ini_time_utc[15] = (utc_time->minutes);
+    ubx_mga_ini_time_utc[16] = (utc_time->seconds);
+    // Accuracy.
+    ubx_mga_ini_time_utc[22] = (uint8_t) (time_accuracy_seconds >> 0);
+    ubx_mga_ini_time_utc[23] = (uint8_t) (time_accuracy_seconds >> 8);
+    // Send message.
+    status = _NEOM8X_inject_mga_message(ubx_mga_ini_time_utc, NEOM8X_UBX_MGA_INI_TIME_UTC_SIZE_BYTES);
+    if (status != NEOM8X_SUCCESS) goto errors;
+errors:
+    return status;
+}
 #endif
-#ifdef NEOM8X_DRIVER_GPS_DATA_POSITION
-    _NEOM8X_reset_position(&gps_position);
+
+#ifdef NEOM8X_DRIVER_UBX_MGA
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_inject_aiding_position(NEOM8X_aiding_position_t* position) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    // See MGA-INI-POS_LLH section for UBX message format.
+    uint8_t ubx_mga_ini_pos_llh[NEOM8X_UBX_MSG_OVERHEAD_SIZE_BYTES + NEOM8X_UBX_MGA_INI_POS_LLH_SIZE_BYTES] = {
+        0xB5, 0x62,                                     // Preamble.
+        NEOM8X_UBX_CLASS_MGA, NEOM8X_UBX_ID_MGA_INI,    // UBX message class and ID.
+        NEOM8X_UBX_MGA_INI_POS_LLH_SIZE_BYTES, 0x00,    // Length.
+        0x01,                                           // Type (geodetic position).
+        0x00,                                           // Version.
+        0x00, 0x00,                                     // Reserved.
+        0, 0, 0, 0,                                     // Latitude.
+        0, 0, 0, 0,                                     // Longitude.
+        0, 0, 0, 0,                                     // Altitude.
+        0, 0, 0, 0,                                     // Position accuracy.
+        0x00, 0x00                                      // UBX checksum.
+    };
+    uint8_t idx = 0;
+    // Check parameters.
+    if (position == NULL) {
+        status = NEOM8X_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Bytes 10-25 = latitude, longitude, altitude and accuracy.
+    for (idx = 0; idx < 4; idx++) {
+        ubx_mga_ini_pos_llh[10 + idx] = (uint8_t) (((uint32_t) (position->latitude_e7)) >> (8 * idx));
+        ubx_mga_ini_pos_llh[14 + idx] = (uint8_t) (((uint32_t) (position->longitude_e7)) >> (8 * idx));
+        ubx_mga_ini_pos_llh[18 + idx] = (uint8_t) (((uint32_t) (position->altitude_cm)) >> (8 * idx));
+        ubx_mga_ini_pos_llh[22 + idx] = (uint8_t) ((position->accuracy_cm) >> (8 * idx));
+    }
+    // Send message.
+    status = _NEOM8X_inject_mga_message(ubx_mga_ini_pos_llh, NEOM8X_UBX_MGA_INI_POS_LLH_SIZE_BYTES);
+    if (status != NEOM8X_SUCCESS) goto errors;
+errors:
+    return status;
+}
 #endif
-    // Decode incoming NMEA message.
-    switch (neom8x_ctx.acquisition.gps_data) {
-#ifdef NEOM8X_DRIVER_GPS_DATA_TIME
-    case NEOM8X_GPS_DATA_TIME:
-        // Parse buffer.
-        _NEOM8X_parse_nmea_zda((char_t*) neom8x_ctx.nmea_buffer[neom8x_ctx.nmea_buffer_idx_ready], &gps_time, &decode_success_flag);
-        // Check decoding result.
-        if (decode_success_flag != 0) {
-            // Copy data and update status.
-            _NEOM8X_copy_time(&gps_time, &(neom8x_ctx.gps_time));
-            acquisition_status = NEOM8X_ACQUISITION_STATUS_FOUND;
+
+#ifdef NEOM8X_DRIVER_UBX_MGA
+/*******************************************************************/
+NEOM8X_status_t NEOM8X_inject_aiding_data(uint8_t* mga_data, uint32_t mga_data_size_bytes, NEOM8X_aiding_result_t* aiding_result) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_SUCCESS;
+    uint32_t data_idx = 0;
+    uint32_t frame_size = 0;
+    uint32_t idx = 0;
+    uint8_t ck_a = 0;
+    uint8_t ck_b = 0;
+    uint8_t accepted_flag = 0;
+    // Check parameters.
+    if ((mga_data == NULL) || (aiding_result == NULL)) {
+        status = NEOM8X_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Reset result.
+    (aiding_result->processed_size_bytes) = 0;
+    (aiding_result->accepted_message_count) = 0;
+    (aiding_result->rejected_message_count) = 0;
+    (aiding_result->skipped_message_count) = 0;
+    status = _NEOM8X_start_aiding();
+    if (status != NEOM8X_SUCCESS) goto errors;
+    // Send all complete frames of the buffer.
+    while ((data_idx + NEOM8X_UBX_MSG_OVERHEAD_SIZE_BYTES) <= mga_data_size_bytes) {
+        // Search preamble.
+        if ((mga_data[data_idx] != NEOM8X_UBX_SYNC_CHAR_1) || (mga_data[data_idx + 1] != NEOM8X_UBX_SYNC_CHAR_2)) {
+            data_idx++;
+            continue;
         }
-        break;
-#endif
-#ifdef NEOM8X_DRIVER_GPS_DATA_POSITION
-    case NEOM8X_GPS_DATA_POSITION:
-        // Parse buffer.
-        _NEOM8X_parse_nmea_gga((char_t*) neom8x_ctx.nmea_buffer[neom8x_ctx.nmea_buffer_idx_ready], &gps_position, &decode_success_flag);
-        // Check decoding result.
-        if (decode_success_flag != 0) {
-            // Copy data and update status.
-            _NEOM8X_copy_position(&gps_position, &(neom8x_ctx.gps_position));
-            acquisition_status = NEOM8X_ACQUISITION_STATUS_FOUND;
-#if (NEOM8X_DRIVER_ALTITUDE_STABILITY_FILTER_MODE > 0)
-            // Directly exit if the filter is disabled.
-            if (NEOM8X_ALTITUDE_STABILITY_THRESHOLD >= 2) {
-                // Manage altitude stability count.
-                if ((neom8x_ctx.gps_position.altitude) == neom8x_ctx.previous_altitude) {
-                    neom8x_ctx.same_altitude_count++;
-                    // Compare to threshold.
-                    if (neom8x_ctx.same_altitude_count >= (NEOM8X_ALTITUDE_STABILITY_THRESHOLD - 1)) {
-                        // Update status.
-                        acquisition_status = NEOM8X_ACQUISITION_STATUS_STABLE;
-                    }
-                }
-                else {
-                    neom8x_ctx.same_altitude_count = 0;
-                }
-                // Update previous altitude.
-                neom8x_ctx.previous_altitude = (neom8x_ctx.gps_position.altitude);
+        // Last frame may be completed by the next call.
+        frame_size = (uint32_t) (NEOM8X_UBX_MSG_OVERHEAD_SIZE_BYTES + (mga_data[data_idx + 4] | (mga_data[data_idx + 5] << 8)));
+        if ((data_idx + frame_size) > mga_data_size_bytes) break;
+        // Check checksum.
+        ck_a = 0;
+        ck_b = 0;
+        for (idx = (data_idx + NEOM8X_UBX_CHECKSUM_OFFSET_BYTES); idx < (data_idx + frame_size - NEOM8X_UBX_CHECKSUM_OFFSET_BYTES); idx++) {
+            _NEOM8X_update_ubx_checksum(ck_a, ck_b, mga_data[idx]);
+        }
+        if ((mga_data[idx] != ck_a) || (mga_data[idx + 1] != ck_b)) {
+            // Resynchronize on next preamble.
+            (aiding_result->skipped_message_count)++;
+            data_idx++;
+            continue;
+        }
+        // Only aiding messages acknowledged by MGA-ACK are sent (flash database messages have their own protocol).
+        if ((mga_data[data_idx + 2] != NEOM8X_UBX_CLASS_MGA) || (mga_data[data_idx + 3] == NEOM8X_UBX_ID_MGA_FLASH) || (mga_data[data_idx + 3] == NEOM8X_UBX_ID_MGA_ACK)) {
+            (aiding_result->skipped_message_count)++;
+        }
+        else {
+            status = _NEOM8X_send_mga_message(&(mga_data[data_idx]), frame_size, &accepted_flag);
+            if (status != NEOM8X_SUCCESS) break;
+            if (accepted_flag != 0) {
+                (aiding_result->accepted_message_count)++;
+            }
+            else {
+                (aiding_result->rejected_message_count)++;
             }
-#endif
         }
-        break;
-#endif
-    default:
-        status = NEOM8X_ERROR_ACQUISITION_DATA;
-        goto errors;
-    }
-    // Call callback in case of success.
-    if (acquisition_status != NEOM8X_ACQUISITION_STATUS_FAIL) {
-        neom8x_ctx.acquisition.completion_callback(acquisition_status);
+        data_idx += frame_size;
     }
+    (aiding_result->processed_size_bytes) = data_idx;
+    NEOM8X_HW_stop_rx();
 errors:
     return status;
 }
+#endif
 
-#ifdef NEOM8X_DRIVER_GPS_DATA_TIME
+#ifdef NEOM8X_DRIVER_UBX_SOS
 /*******************************************************************/
-NEOM8X_status_t NEOM8X_get_time(NEOM8X_time_t* gps_time) {
+NEOM8X_status_t NEOM8X_shutdown(void) {
     // Local variables.
     NEOM8X_status_t status = NEOM8X_SUCCESS;
-    // Check parameter.
-    if (gps_time == NULL) {
-        status = NEOM8X_ERROR_NULL_PARAMETER;
+    // See UPD-SOS section for UBX message format.
+    uint8_t ubx_upd_sos[NEOM8X_UBX_MSG_OVERHEAD_SIZE_BYTES + NEOM8X_UBX_UPD_SOS_COMMAND_SIZE_BYTES] = {
+        0xB5, 0x62,                                   // Preamble.
+        NEOM8X_UBX_CLASS_UPD, NEOM8X_UBX_ID_UPD_SOS,  // UBX message class and ID.
+        NEOM8X_UBX_UPD_SOS_COMMAND_SIZE_BYTES, 0x00,  // Length.
+        NEOM8X_UBX_UPD_SOS_CMD_CREATE_BACKUP,         // Command.
+        0x00, 0x00, 0x00,                             // Reserved.
+        0x00, 0x00                                    // UBX checksum.
+    };
+    // Check state.
+    if (neom8x_ctx.acquisition.gps_data != NEOM8X_GPS_DATA_NONE) {
+        status = NEOM8X_ERROR_ACQUISITION_RUNNING;
         goto errors;
     }
-    // Copy data.
-    _NEOM8X_copy_time(&(neom8x_ctx.gps_time), gps_time);
+    // Receiver configuration is lost on the power cycle expected after shutdown.
+    neom8x_ctx.known_configuration_mask = 0;
+    // Start reception.
+    status = NEOM8X_HW_start_rx();
+    if (status != NEOM8X_SUCCESS) goto errors;
+    // Stop GNSS (restarted by the next acquisition if the module is not power cycled).
+    neom8x_ctx.gnss_stopped_flag = 1;
+    status = _NEOM8X_send_gnss_reset(NEOM8X_UBX_CFG_RST_MODE_GNSS_STOP);
+    if (status != NEOM8X_SUCCESS) {
+        NEOM8X_HW_stop_rx();
+        goto errors;
+    }
+    // Write navigation data in flash.
+    status = _NEOM8X_send_sos_command(ubx_upd_sos, NEOM8X_UBX_UPD_SOS_COMMAND_SIZE_BYTES, NEOM8X_UBX_UPD_SOS_CMD_BACKUP_ACK, NEOM8X_UBX_UPD_SOS_ACK_TIMEOUT_MS);
+    NEOM8X_HW_stop_rx();
+    if (status != NEOM8X_SUCCESS) goto errors;
+    if (neom8x_ctx.sos_response == 0) {
+        status = NEOM8X_ERROR_UBX_NAK;
+        goto errors;
+    }
+#ifdef NEOM8X_DRIVER_VBCKP_CONTROL
+    // Backup voltage is not required anymore to perform a hot start.
+    status = NEOM8X_set_backup_voltage(0);
+    if (status != NEOM8X_SUCCESS) goto errors;
+#endif
 errors:
     return status;
 }
 #endif
 
-#ifdef NEOM8X_DRIVER_GPS_DATA_POSITION
+#ifdef NEOM8X_DRIVER_UBX_SOS
 /*******************************************************************/
-NEOM8X_status_t NEOM8X_get_position(NEOM8X_position_t* gps_position) {
+NEOM8X_status_t NEOM8X_get_backup_restore_status(NEOM8X_backup_restore_status_t* restore_status) {
     // Local variables.
     NEOM8X_status_t status = NEOM8X_SUCCESS;
-    // Check parameters.
-    if (gps_position == NULL) {
+    // Check parameter.
+    if (restore_status == NULL) {
         status = NEOM8X_ERROR_NULL_PARAMETER;
         goto errors;
     }
-    // Copy data.
-    _NEOM8X_copy_position(&(neom8x_ctx.gps_position), gps_position);
+    (*restore_status) = neom8x_ctx.backup_restore_status;
 errors:
     return status;
 }
@@ -918,6 +3684,10 @@ errors:
 NEOM8X_status_t NEOM8X_set_backup_voltage(uint8_t state) {
     // Local variables.
     NEOM8X_status_t status = NEOM8X_SUCCESS;
+    // Receiver configuration is lost when backup voltage is removed.
+    if (state == 0) {
+        neom8x_ctx.known_configuration_mask = 0;
+    }
     // Call hardware function.
     status = NEOM8X_HW_set_backup_voltage(state);
     return status;
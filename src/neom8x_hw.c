@@ -69,6 +69,23 @@ NEOM8X_status_t __attribute__((weak)) NEOM8X_HW_delay_milliseconds(uint32_t dela
     return status;
 }
 
+/*******************************************************************/
+NEOM8X_status_t __attribute__((weak)) NEOM8X_HW_start_timer(uint32_t duration_ms) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_ERROR_HW_FUNCTION_NOT_IMPLEMENTED;
+    /* To be implemented */
+    UNUSED(duration_ms);
+    return status;
+}
+
+/*******************************************************************/
+NEOM8X_status_t __attribute__((weak)) NEOM8X_HW_stop_timer(void) {
+    // Local variables.
+    NEOM8X_status_t status = NEOM8X_ERROR_HW_FUNCTION_NOT_IMPLEMENTED;
+    /* To be implemented */
+    return status;
+}
+
 #ifdef NEOM8X_DRIVER_VBCKP_CONTROL
 /*******************************************************************/
 NEOM8X_status_t __attribute__((weak)) NEOM8X_HW_set_backup_voltage(uint8_t state) {